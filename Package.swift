@@ -275,6 +275,8 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/stream_lists.h",
         "src/core/ext/transport/chttp2/transport/varint.cc",
         "src/core/ext/transport/chttp2/transport/varint.h",
+        "src/core/ext/transport/chttp2/transport/write_scheduler.cc",
+        "src/core/ext/transport/chttp2/transport/write_scheduler.h",
         "src/core/ext/transport/chttp2/transport/write_size_policy.cc",
         "src/core/ext/transport/chttp2/transport/write_size_policy.h",
         "src/core/ext/transport/chttp2/transport/writing.cc",
@@ -1161,6 +1163,7 @@ let package = Package(
         "src/core/lib/event_engine/default_event_engine_factory.h",
         "src/core/lib/event_engine/event_engine.cc",
         "src/core/lib/event_engine/event_engine_context.h",
+        "src/core/lib/event_engine/extensions/bdp_estimate.h",
         "src/core/lib/event_engine/extensions/can_track_errors.h",
         "src/core/lib/event_engine/extensions/chaotic_good_extension.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
@@ -1175,6 +1178,8 @@ let package = Package(
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1187,6 +1192,10 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/lockfree_event.h",
         "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc",
         "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.h",
+        "src/core/lib/event_engine/posix_engine/poller_inline_scheduler.cc",
+        "src/core/lib/event_engine/posix_engine/poller_inline_scheduler.h",
+        "src/core/lib/event_engine/posix_engine/poller_write_queue.cc",
+        "src/core/lib/event_engine/posix_engine/poller_write_queue.h",
         "src/core/lib/event_engine/posix_engine/posix_endpoint.cc",
         "src/core/lib/event_engine/posix_engine/posix_endpoint.h",
         "src/core/lib/event_engine/posix_engine/posix_engine.cc",
@@ -1253,6 +1262,8 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/sharded_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/sharded_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1849,6 +1860,7 @@ let package = Package(
         "src/core/util/chunked_vector.h",
         "src/core/util/construct_destruct.h",
         "src/core/util/cpp_impl_of.h",
+        "src/core/util/cpu_topology.h",
         "src/core/util/crash.cc",
         "src/core/util/crash.h",
         "src/core/util/debug_location.h",
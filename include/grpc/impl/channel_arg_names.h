@@ -259,8 +259,44 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP RX Zerocopy enable state: zero is disabled, non-zero is enabled. When
+   enabled, large reads map the received pages into slices with
+   TCP_ZEROCOPY_RECEIVE instead of copying them. By default, it is disabled. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+/* TCP RX Zerocopy receive threshold: only try zerocopy receives when at least
+   this many bytes are expected to be read. By default, this is set to 128KB. */
+#define GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_recv_bytes_threshold"
 /* Overrides the TCP socket receive buffer size, SO_RCVBUF. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
+/* If non-zero, and GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE is not set, size the TCP
+   socket receive buffer, SO_RCVBUF, after the bandwidth-delay product that
+   the transport estimates for the connection. Note that setting SO_RCVBUF
+   turns off the kernel's receive buffer auto-tuning for that socket. By
+   default, it is disabled. */
+#define GRPC_ARG_TCP_RECEIVE_BUFFER_FROM_BDP \
+  "grpc.experimental.tcp_receive_buffer_from_bdp"
+/* If non-zero, the POSIX EventEngine may run an endpoint's read completion,
+   including the caller's read callback, inline on the poller thread (see
+   GRPC_POLLER_INLINE_BUDGET_US). Only set this when every read callback
+   passed to the endpoint is guaranteed not to block. By default, it is
+   disabled. */
+#define GRPC_ARG_TCP_INLINE_READ_CALLBACKS \
+  "grpc.experimental.tcp_inline_read_callbacks"
+/* Number of listening sockets the POSIX EventEngine opens for each bound
+   address. When greater than 1 and SO_REUSEPORT is available, the extra sockets
+   share the address and port so that the kernel spreads incoming connections
+   (and the work of accepting them) across them. A value of 0 opens one socket
+   per CPU core. By default, this is set to 1. */
+#define GRPC_ARG_TCP_LISTENER_SHARDS "grpc.experimental.tcp_listener_shards"
+/* Sets SO_BUSY_POLL (and SO_PREFER_BUSY_POLL, if available) on TCP sockets
+   created by the POSIX EventEngine, so that blocking reads and polls busy wait
+   on the device queue for up to this many microseconds. Raising the value
+   above net.core.busy_read may require CAP_NET_ADMIN; failures are ignored.
+   Has no effect where the system headers do not define SO_BUSY_POLL.
+   By default, this is 0 (disabled). */
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
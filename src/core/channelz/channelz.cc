@@ -630,6 +630,18 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = Json::FromString(absl::StrCat(keepalives_sent));
   }
+  int64_t local_flow_control_window =
+      local_flow_control_window_.load(std::memory_order_relaxed);
+  if (local_flow_control_window != kNoFlowControlWindow) {
+    data["localFlowControlWindow"] =
+        Json::FromString(absl::StrCat(local_flow_control_window));
+  }
+  int64_t remote_flow_control_window =
+      remote_flow_control_window_.load(std::memory_order_relaxed);
+  if (remote_flow_control_window != kNoFlowControlWindow) {
+    data["remoteFlowControlWindow"] =
+        Json::FromString(absl::StrCat(remote_flow_control_window));
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref", Json::FromObject({
@@ -27,6 +27,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <map>
 #include <optional>
 #include <set>
@@ -365,6 +366,14 @@ class SocketNode final : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.fetch_add(1, std::memory_order_relaxed);
   }
+  // Records the current flow control windows of the connection, in bytes:
+  // how much the peer allows us to send (local), and how much we allow the
+  // peer to send (remote).
+  void RecordFlowControlWindows(int64_t local_window, int64_t remote_window) {
+    local_flow_control_window_.store(local_window, std::memory_order_relaxed);
+    remote_flow_control_window_.store(remote_window,
+                                      std::memory_order_relaxed);
+  }
 
   const std::string& remote() { return remote_; }
 
@@ -375,6 +384,11 @@ class SocketNode final : public BaseNode {
   std::atomic<int64_t> messages_sent_{0};
   std::atomic<int64_t> messages_received_{0};
   std::atomic<int64_t> keepalives_sent_{0};
+  // kNoFlowControlWindow until the transport records its windows.
+  static constexpr int64_t kNoFlowControlWindow =
+      std::numeric_limits<int64_t>::min();
+  std::atomic<int64_t> local_flow_control_window_{kNoFlowControlWindow};
+  std::atomic<int64_t> remote_flow_control_window_{kNoFlowControlWindow};
   std::atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
@@ -61,6 +61,34 @@ ABSL_FLAG(absl::optional<std::string>, grpc_poll_strategy, {},
           "Declares which polling engines to try when starting gRPC. This is a "
           "comma-separated list of engines, which are tried in priority order "
           "first -> last.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_poller_spin_us, {},
+          "EXPERIMENTAL. Upper bound in microseconds on how long the epoll1 "
+          "poller spins, polling without blocking, before it goes to sleep in "
+          "epoll_wait. The window shrinks to nothing while spinning finds no "
+          "events, and reopens when events show up soon after the poller went "
+          "to sleep. Set to 0 (the default) to never spin.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_poller_write_batch_size, {},
+          "EXPERIMENTAL. Maximum number of write callbacks, for fds that "
+          "became writable in the same poller pass, that are run back to back "
+          "by a single scheduled callback. Set to 0 (the default) or 1 to "
+          "schedule each write callback on its own.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_poller_inline_budget_us, {},
+          "EXPERIMENTAL. Upper bound in microseconds on how long the poller "
+          "runs, on its own thread, the non-blocking read callbacks of the "
+          "fds that became readable in a poller pass. The callbacks left once "
+          "the budget is spent are handed to the thread pool. Set to 0 (the "
+          "default) to hand every callback to the thread pool.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_timer_wheel, {},
+          "EXPERIMENTAL. If true, the POSIX EventEngine keeps its timers in "
+          "hierarchical timing wheels instead of sharded heaps.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_thread_affinity, {},
+          "EXPERIMENTAL. If true, EventEngine worker threads are pinned to the "
+          "CPUs of a NUMA node, and steal work from threads of their own node "
+          "first.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_sharded_work_queue, {},
+          "EXPERIMENTAL. If true, the EventEngine thread pool queues the work "
+          "scheduled from outside of its threads in per-CPU shards instead of "
+          "a single queue.");
 ABSL_FLAG(absl::optional<bool>, grpc_abort_on_leaks, {},
           "A debugging aid to cause a call to abort() when gRPC objects are "
           "leaked past grpc_shutdown()");
@@ -84,9 +112,29 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_client_channel_backup_poll_interval_ms,
                      "GRPC_CLIENT_CHANNEL_BACKUP_POLL_INTERVAL_MS",
                      overrides.client_channel_backup_poll_interval_ms, 5000)),
+      poller_spin_us_(LoadConfig(FLAGS_grpc_poller_spin_us,
+                                 "GRPC_POLLER_SPIN_US",
+                                 overrides.poller_spin_us, 0)),
+      poller_write_batch_size_(LoadConfig(
+          FLAGS_grpc_poller_write_batch_size, "GRPC_POLLER_WRITE_BATCH_SIZE",
+          overrides.poller_write_batch_size, 0)),
+      poller_inline_budget_us_(LoadConfig(
+          FLAGS_grpc_poller_inline_budget_us, "GRPC_POLLER_INLINE_BUDGET_US",
+          overrides.poller_inline_budget_us, 0)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
+      event_engine_timer_wheel_(LoadConfig(
+          FLAGS_grpc_event_engine_timer_wheel, "GRPC_EVENT_ENGINE_TIMER_WHEEL",
+          overrides.event_engine_timer_wheel, false)),
+      event_engine_thread_affinity_(
+          LoadConfig(FLAGS_grpc_event_engine_thread_affinity,
+                     "GRPC_EVENT_ENGINE_THREAD_AFFINITY",
+                     overrides.event_engine_thread_affinity, false)),
+      event_engine_sharded_work_queue_(
+          LoadConfig(FLAGS_grpc_event_engine_sharded_work_queue,
+                     "GRPC_EVENT_ENGINE_SHARDED_WORK_QUEUE",
+                     overrides.event_engine_sharded_work_queue, false)),
       abort_on_leaks_(LoadConfig(FLAGS_grpc_abort_on_leaks,
                                  "GRPC_ABORT_ON_LEAKS",
                                  overrides.abort_on_leaks, false)),
@@ -139,6 +187,15 @@ std::string ConfigVars::ToString() const {
       absl::CEscape(Verbosity()), "\"",
       ", enable_fork_support: ", EnableForkSupport() ? "true" : "false",
       ", poll_strategy: ", "\"", absl::CEscape(PollStrategy()), "\"",
+      ", poller_spin_us: ", PollerSpinUs(),
+      ", poller_write_batch_size: ", PollerWriteBatchSize(),
+      ", poller_inline_budget_us: ", PollerInlineBudgetUs(),
+      ", event_engine_timer_wheel: ",
+      EventEngineTimerWheel() ? "true" : "false",
+      ", event_engine_thread_affinity: ",
+      EventEngineThreadAffinity() ? "true" : "false",
+      ", event_engine_sharded_work_queue: ",
+      EventEngineShardedWorkQueue() ? "true" : "false",
       ", abort_on_leaks: ", AbortOnLeaks() ? "true" : "false",
       ", system_ssl_roots_dir: ", "\"", absl::CEscape(SystemSslRootsDir()),
       "\"", ", default_ssl_roots_file_path: ", "\"",
@@ -35,7 +35,13 @@ class GPR_DLL ConfigVars {
  public:
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
+    absl::optional<int32_t> poller_spin_us;
+    absl::optional<int32_t> poller_write_batch_size;
+    absl::optional<int32_t> poller_inline_budget_us;
     absl::optional<bool> enable_fork_support;
+    absl::optional<bool> event_engine_timer_wheel;
+    absl::optional<bool> event_engine_thread_affinity;
+    absl::optional<bool> event_engine_sharded_work_queue;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<bool> cpp_experimental_disable_reflection;
@@ -87,6 +93,37 @@ class GPR_DLL ConfigVars {
   // comma-separated list of engines, which are tried in priority order first ->
   // last.
   absl::string_view PollStrategy() const { return poll_strategy_; }
+  // EXPERIMENTAL. Upper bound in microseconds on how long the epoll1 poller
+  // spins, polling without blocking, before it goes to sleep in epoll_wait. The
+  // window shrinks to nothing while spinning finds no events, and reopens when
+  // events show up soon after the poller went to sleep. Set to 0 (the default)
+  // to never spin.
+  int32_t PollerSpinUs() const { return poller_spin_us_; }
+  // EXPERIMENTAL. Maximum number of write callbacks, for fds that became
+  // writable in the same poller pass, that are run back to back by a single
+  // scheduled callback. Set to 0 (the default) or 1 to schedule each write
+  // callback on its own.
+  int32_t PollerWriteBatchSize() const { return poller_write_batch_size_; }
+  // EXPERIMENTAL. Upper bound in microseconds on how long the poller runs, on
+  // its own thread, the non-blocking read callbacks of the fds that became
+  // readable in a poller pass. The callbacks left once the budget is spent are
+  // handed to the thread pool. Set to 0 (the default) to hand every callback
+  // to the thread pool.
+  int32_t PollerInlineBudgetUs() const { return poller_inline_budget_us_; }
+  // EXPERIMENTAL. If true, the POSIX EventEngine keeps its timers in
+  // hierarchical timing wheels instead of sharded heaps.
+  bool EventEngineTimerWheel() const { return event_engine_timer_wheel_; }
+  // EXPERIMENTAL. If true, EventEngine worker threads are pinned to the CPUs
+  // of a NUMA node, and steal work from threads of their own node first.
+  bool EventEngineThreadAffinity() const {
+    return event_engine_thread_affinity_;
+  }
+  // EXPERIMENTAL. If true, the EventEngine thread pool queues the work
+  // scheduled from outside of its threads in per-CPU shards instead of a
+  // single queue.
+  bool EventEngineShardedWorkQueue() const {
+    return event_engine_sharded_work_queue_;
+  }
   // A debugging aid to cause a call to abort() when gRPC objects are leaked
   // past grpc_shutdown()
   bool AbortOnLeaks() const { return abort_on_leaks_; }
@@ -110,7 +147,13 @@ class GPR_DLL ConfigVars {
   static const ConfigVars& Load();
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
+  int32_t poller_spin_us_;
+  int32_t poller_write_batch_size_;
+  int32_t poller_inline_budget_us_;
   bool enable_fork_support_;
+  bool event_engine_timer_wheel_;
+  bool event_engine_thread_affinity_;
+  bool event_engine_sharded_work_queue_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
   bool cpp_experimental_disable_reflection_;
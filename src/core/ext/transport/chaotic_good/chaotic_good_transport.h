@@ -27,6 +27,8 @@
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/ext/transport/chaotic_good/message_chunker.h"
+#include "src/core/ext/transport/chaotic_good/receive_buffer_pool.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
@@ -36,6 +38,7 @@
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_join.h"
 #include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/transport/call_spine.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 
@@ -90,6 +93,14 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
     uint32_t encode_alignment = 64;
     uint32_t decode_alignment = 64;
     uint32_t inlined_payload_size_threshold = 8 * 1024;
+    // If set, kept informed of the data endpoints' state so that chunk sizes
+    // can adapt to it.
+    RefCountedPtr<ChunkSizePolicy> chunk_size_policy;
+    // If non-zero, payloads read are copied into pooled buffers of this size,
+    // aligned to decode_alignment (which must then be a power of two), and
+    // charged to memory_quota.
+    uint32_t receive_buffer_size = 0;
+    MemoryQuotaRefPtr memory_quota;
   };
 
   ChaoticGoodTransport(
@@ -101,7 +112,10 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
       : event_engine_(std::move(event_engine)),
         control_endpoint_(std::move(control_endpoint), event_engine_.get()),
         data_endpoints_(std::move(pending_data_endpoints), event_engine_.get(),
-                        enable_tracing),
+                        enable_tracing,
+                        ReceiveBufferPool::Options{options.receive_buffer_size,
+                                                   options.decode_alignment,
+                                                   options.memory_quota}),
         options_(options) {}
 
   auto WriteFrame(const FrameInterface& frame) {
@@ -129,6 +143,11 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
           header.payload_connection_id = 1;
           const size_t padding = header.Padding(options_.encode_alignment);
           frame.SerializePayload(payload);
+          if (options_.chunk_size_policy != nullptr) {
+            options_.chunk_size_policy->SetDataEndpoints(
+                data_endpoints_.ready_endpoints(),
+                data_endpoints_.throughput_skew());
+          }
           GRPC_TRACE_LOG(chaotic_good, INFO)
               << "CHAOTIC_GOOD: Send " << payload.Length()
               << "b payload on data channel; add " << padding << " bytes for "
@@ -239,6 +258,9 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
     return std::move(s);
   }
 
+  // For adding and retiring data endpoints after the handshake.
+  DataEndpoints& data_endpoints() { return data_endpoints_; }
+
  private:
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
   ControlEndpoint control_endpoint_;
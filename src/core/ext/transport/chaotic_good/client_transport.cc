@@ -38,6 +38,7 @@
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/switch.h"
@@ -184,6 +185,36 @@ auto ChaoticGoodClientTransport::TransportReadLoop(
                           return DispatchFrame<MessageChunkFrame>(
                               std::move(transport), std::move(incoming_frame));
                         }),
+                        Case<FrameType::kSettings>([&, this]() {
+                          return TrySeq(
+                              incoming_frame.Payload(),
+                              [this, transport = std::move(transport),
+                               header = incoming_frame.header()](
+                                  SliceBuffer payload)
+                                  -> absl::StatusOr<SettingsFrame> {
+                                auto frame =
+                                    transport->DeserializeFrame<SettingsFrame>(
+                                        header, std::move(payload));
+                                if (!frame.ok()) return frame.status();
+                                return ProcessSettings(*transport, frame->body);
+                              },
+                              [this](SettingsFrame reply) {
+                                return If(
+                                    reply.body.retire_data_connection().empty(),
+                                    []() { return absl::OkStatus(); },
+                                    [&]() {
+                                      return Map(
+                                          outgoing_frames_.MakeSender().Send(
+                                              std::move(reply)),
+                                          [](bool ok) {
+                                            return ok ? absl::OkStatus()
+                                                      : absl::UnavailableError(
+                                                            "Transport "
+                                                            "closed.");
+                                          });
+                                    });
+                              });
+                        }),
                         Default([&]() {
                           LOG_EVERY_N_SEC(INFO, 10)
                               << "Bad frame type: "
@@ -195,6 +226,40 @@ auto ChaoticGoodClientTransport::TransportReadLoop(
   });
 }
 
+absl::StatusOr<SettingsFrame> ChaoticGoodClientTransport::ProcessSettings(
+    ChaoticGoodTransport& transport,
+    const chaotic_good_frame::Settings& settings) {
+  auto& data_endpoints = transport.data_endpoints();
+  SettingsFrame reply;
+  if (settings.connection_id_size() != 0 && max_data_connections_ == 0) {
+    return absl::InternalError(
+        "Server added data connections without negotiating it");
+  }
+  for (const auto& connection_id : settings.connection_id()) {
+    const uint32_t id =
+        data_endpoints.AddEndpoint(connector_->Connect(connection_id));
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Client transport " << this << " add data endpoint "
+        << id;
+  }
+  for (const uint32_t connection_id : settings.retire_data_connection()) {
+    if (connection_id == 0 || connection_id > data_endpoints.size()) {
+      return absl::InternalError(
+          absl::StrCat("Retired unknown data connection ", connection_id));
+    }
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Client transport " << this
+        << " retire data endpoint " << connection_id - 1;
+    // Every frame the server sent on this endpoint was announced before this
+    // settings frame, and every frame we sent there is announced before our
+    // reply.
+    data_endpoints.StopReading(connection_id - 1);
+    data_endpoints.StopWriting(connection_id - 1);
+    reply.body.add_retire_data_connection(connection_id);
+  }
+  return reply;
+}
+
 auto ChaoticGoodClientTransport::OnTransportActivityDone(
     absl::string_view what) {
   return [self = RefAsSubclass<ChaoticGoodClientTransport>(),
@@ -208,10 +273,14 @@ auto ChaoticGoodClientTransport::OnTransportActivityDone(
 
 ChaoticGoodClientTransport::ChaoticGoodClientTransport(
     const ChannelArgs& args, PromiseEndpoint control_endpoint, Config config,
-    RefCountedPtr<ClientConnectionFactory>)
+    RefCountedPtr<ClientConnectionFactory> connector)
     : allocator_(args.GetObject<ResourceQuota>()
                      ->memory_quota()
                      ->CreateMemoryAllocator("chaotic-good")),
+      connector_(std::move(connector)),
+      max_data_connections_(connector_ == nullptr
+                                ? 0
+                                : config.max_data_connections()),
       outgoing_frames_(4),
       message_chunker_(config.MakeMessageChunker()) {
   auto event_engine =
@@ -107,8 +107,16 @@ class ChaoticGoodClientTransport final : public ClientTransport {
                          RefCountedPtr<Stream> stream);
   auto PushFrameIntoCall(BeginMessageFrame frame, RefCountedPtr<Stream> stream);
   auto PushFrameIntoCall(MessageChunkFrame frame, RefCountedPtr<Stream> stream);
+  // Handle a settings frame received after the handshake; returns the settings
+  // frame to send back to the server.
+  absl::StatusOr<SettingsFrame> ProcessSettings(
+      ChaoticGoodTransport& transport,
+      const chaotic_good_frame::Settings& settings);
 
   grpc_event_engine::experimental::MemoryAllocator allocator_;
+  const RefCountedPtr<ClientConnectionFactory> connector_;
+  // Non-zero if the server may add data connections after the handshake.
+  const uint32_t max_data_connections_;
   // Max buffer is set to 4, so that for stream writes each time it will queue
   // at most 2 frames.
   MpscReceiver<ClientFrame> outgoing_frames_;
@@ -15,15 +15,24 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
+#include "absl/numeric/bits.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
 #include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
 #include "src/core/ext/transport/chaotic_good/message_chunker.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -35,6 +44,31 @@ namespace chaotic_good {
   "grpc.chaotic_good.max_send_chunk_size"
 #define GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD \
   "grpc.chaotic_good.inlined_payload_size_threshold"
+// Adapt the send chunk size (up to the negotiated maximum) to the number and
+// speed of data endpoints and to observed message sizes. Off by default.
+#define GRPC_ARG_CHAOTIC_GOOD_ADAPTIVE_CHUNK_SIZE \
+  "grpc.chaotic_good.adaptive_chunk_size"
+// Offer (server) or accept (client) an extra data endpoint carried over shared
+// memory when both peers are on the same host. Linux only; off by default.
+#define GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_DATA_ENDPOINT \
+  "grpc.chaotic_good.shared_memory_data_endpoint"
+// Size in bytes of each direction's ring in the shared memory region (server
+// side; rounded up to a power of two).
+#define GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_RING_SIZE \
+  "grpc.chaotic_good.shared_memory_ring_size"
+// Let the server add and retire data connections after the handshake as
+// throughput demand changes, keeping between 1 and this many. Both peers must
+// set it (the smaller value is used); unset or 0 keeps the data connection
+// count fixed.
+#define GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS \
+  "grpc.chaotic_good.max_data_connections"
+// Copy each payload read from a data endpoint into a single buffer aligned to
+// our decode alignment, reusing buffers sized from the negotiated receive chunk
+// size across reads. This adds a copy to every read: it is for code that needs
+// aligned, contiguous payloads and for debugging alignment, not for speed. Off
+// by default.
+#define GRPC_ARG_CHAOTIC_GOOD_POOLED_RECEIVE_BUFFERS \
+  "grpc.chaotic_good.pooled_receive_buffers"
 
 // Transport configuration.
 // Most of our configuration is derived from channel args, and then exchanged
@@ -42,6 +76,9 @@ namespace chaotic_good {
 // server.
 class Config {
  public:
+  static constexpr int kMinSharedMemoryRingSize = 64 * 1024;
+  static constexpr int kMaxSharedMemoryRingSize = 256 * 1024 * 1024;
+
   explicit Config(
       const ChannelArgs& channel_args,
       std::initializer_list<chaotic_good_frame::Settings::Features>
@@ -66,6 +103,32 @@ class Config {
                .value_or(inline_payload_size_threshold_));
     tracing_enabled_ =
         channel_args.GetBool(GRPC_ARG_TCP_TRACING_ENABLED).value_or(false);
+    adaptive_chunk_size_ =
+        channel_args.GetBool(GRPC_ARG_CHAOTIC_GOOD_ADAPTIVE_CHUNK_SIZE)
+            .value_or(false);
+    pooled_receive_buffers_ =
+        channel_args.GetBool(GRPC_ARG_CHAOTIC_GOOD_POOLED_RECEIVE_BUFFERS)
+            .value_or(false);
+    max_data_connections_ = std::max(
+        0, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS)
+               .value_or(0));
+    if (channel_args.GetBool(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_DATA_ENDPOINT)
+            .value_or(false)) {
+      supported_features_.insert(chaotic_good_frame::Settings::SHARED_MEMORY);
+    }
+    const int ring_size = std::clamp(
+        channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_RING_SIZE)
+            .value_or(shared_memory_ring_size_),
+        kMinSharedMemoryRingSize, kMaxSharedMemoryRingSize);
+    shared_memory_ring_size_ = 1;
+    while (shared_memory_ring_size_ < static_cast<uint32_t>(ring_size)) {
+      shared_memory_ring_size_ <<= 1;
+    }
+    if (auto* resource_quota = channel_args.GetObject<ResourceQuota>()) {
+      memory_quota_ = resource_quota->memory_quota();
+    } else {
+      memory_quota_ = ResourceQuota::Default()->memory_quota();
+    }
   }
 
   Config(const Config&) = delete;
@@ -79,7 +142,36 @@ class Config {
     pending_data_endpoints_.emplace_back(std::move(endpoint));
   }
 
+  // The shared memory endpoint is not named by a connection id; both sides
+  // place it after all connection id endpoints so that data endpoint indices
+  // agree.
+  absl::Status ServerAddSharedMemoryDataEndpoint(
+      RefCountedPtr<SharedMemoryRegion> region, Duration attach_timeout,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine) {
+    CHECK(supports_shared_memory());
+    std::string name = region->name();
+    auto endpoint = OfferSharedMemoryConnection(
+        std::move(region), attach_timeout, std::move(event_engine),
+        memory_quota_);
+    if (!endpoint.ok()) return endpoint.status();
+    shared_memory_region_ = std::move(name);
+    shared_memory_data_endpoint_.emplace(std::move(*endpoint));
+    return absl::OkStatus();
+  }
+
+  // Whether TakePendingDataEndpoints() will end with the shared memory
+  // endpoint.
+  bool has_shared_memory_data_endpoint() const {
+    return shared_memory_data_endpoint_.has_value();
+  }
+
   std::vector<PendingConnection> TakePendingDataEndpoints() {
+    if (shared_memory_data_endpoint_.has_value()) {
+      pending_data_endpoints_.emplace_back(
+          std::move(*shared_memory_data_endpoint_));
+      shared_memory_data_endpoint_.reset();
+    }
     return std::move(pending_data_endpoints_);
   }
 
@@ -87,6 +179,9 @@ class Config {
     for (const auto& pending_data_endpoint : pending_data_endpoints_) {
       settings.add_connection_id(pending_data_endpoint.id());
     }
+    if (!shared_memory_region_.empty()) {
+      settings.set_shared_memory_region(shared_memory_region_);
+    }
     PrepareOutgoingSettings(settings);
   }
 
@@ -113,6 +208,23 @@ class Config {
     for (const auto& connection_id : settings.connection_id()) {
       pending_data_endpoints_.emplace_back(connector.Connect(connection_id));
     }
+    if (!settings.shared_memory_region().empty()) {
+      if (supports_shared_memory()) {
+        shared_memory_region_ = settings.shared_memory_region();
+        pending_data_endpoints_.emplace_back(
+            AttachSharedMemoryConnection(shared_memory_region_,
+                                         memory_quota_));
+      } else {
+        // Keep our endpoint indices aligned with the server's; the endpoint
+        // never becomes ready and so is never scheduled.
+        pending_data_endpoints_.emplace_back(PendingConnection(
+            settings.shared_memory_region(),
+            []() -> absl::StatusOr<PromiseEndpoint> {
+              return absl::UnimplementedError(
+                  "Shared memory data endpoint not enabled");
+            }));
+      }
+    }
     return ReceiveIncomingSettings(settings);
   }
 
@@ -128,6 +240,12 @@ class Config {
       }
       const auto valid_feature =
           static_cast<chaotic_good_frame::Settings::Features>(feature);
+      // Shared memory is an optional extra: if we don't offer it, carry on
+      // without it.
+      if (valid_feature == chaotic_good_frame::Settings::SHARED_MEMORY &&
+          !supported_features_.contains(valid_feature)) {
+        continue;
+      }
       if (!supported_features_.contains(valid_feature)) {
         return absl::InternalError(absl::StrCat(
             "Unsupported feature present in chaotic-good handshake: ",
@@ -148,12 +266,26 @@ class Config {
     options.encode_alignment = encode_alignment_;
     options.decode_alignment = decode_alignment_;
     options.inlined_payload_size_threshold = inline_payload_size_threshold_;
+    options.chunk_size_policy = chunk_size_policy_;
+    if (pooled_receive_buffers_ && absl::has_single_bit(decode_alignment_)) {
+      // Without chunking a payload can be any size: pool buffers big enough
+      // for typical messages and allocate larger ones as needed.
+      const uint64_t chunk_size =
+          max_recv_chunk_size_ != 0 ? max_recv_chunk_size_ : 1024 * 1024;
+      const uint64_t buffer_size =
+          (chunk_size + decode_alignment_ - 1) & ~(decode_alignment_ - 1);
+      if (buffer_size <= std::numeric_limits<uint32_t>::max()) {
+        options.receive_buffer_size = buffer_size;
+        options.memory_quota = memory_quota_;
+      }
+    }
     return options;
   }
 
   // Factory: create a message chunker based on negotiated settings.
   MessageChunker MakeMessageChunker() const {
-    return MessageChunker(max_send_chunk_size_, encode_alignment_);
+    return MessageChunker(max_send_chunk_size_, encode_alignment_,
+                          chunk_size_policy_);
   }
 
   bool tracing_enabled() const { return tracing_enabled_; }
@@ -161,6 +293,7 @@ class Config {
   void TestOnlySetChunkSizes(uint32_t size) {
     max_send_chunk_size_ = size;
     max_recv_chunk_size_ = size;
+    chunk_size_policy_.reset();
   }
 
   uint32_t encode_alignment() const { return encode_alignment_; }
@@ -171,12 +304,18 @@ class Config {
   uint32_t inline_payload_size_threshold() const {
     return inline_payload_size_threshold_;
   }
+  uint32_t shared_memory_ring_size() const { return shared_memory_ring_size_; }
+  // Upper bound for dynamic data connection scaling; 0 if it was not
+  // negotiated.
+  uint32_t max_data_connections() const { return max_data_connections_; }
 
   std::string ToString() const {
     return absl::StrCat(GRPC_DUMP_ARGS(tracing_enabled_, encode_alignment_,
                                        decode_alignment_, max_send_chunk_size_,
                                        max_recv_chunk_size_,
-                                       inline_payload_size_threshold_));
+                                       inline_payload_size_threshold_,
+                                       shared_memory_region_,
+                                       max_data_connections_));
   }
 
   template <typename Sink>
@@ -188,6 +327,11 @@ class Config {
     return supported_features_.contains(chaotic_good_frame::Settings::CHUNKING);
   }
 
+  bool supports_shared_memory() const {
+    return supported_features_.contains(
+        chaotic_good_frame::Settings::SHARED_MEMORY);
+  }
+
  private:
   // Fill-in a settings frame to be sent with the results of the negotiation so
   // far. For the client this will be whatever we got from channel args; for the
@@ -196,6 +340,11 @@ class Config {
   void PrepareOutgoingSettings(chaotic_good_frame::Settings& settings) const {
     settings.set_alignment(decode_alignment_);
     settings.set_max_chunk_size(max_recv_chunk_size_);
+    settings.set_max_data_connections(max_data_connections_);
+    if (supports_shared_memory()) {
+      settings.add_supported_features(
+          chaotic_good_frame::Settings::SHARED_MEMORY);
+    }
   }
 
   // Receive a settings frame from our peer and integrate its settings with our
@@ -209,16 +358,34 @@ class Config {
       max_recv_chunk_size_ = 0;
       max_send_chunk_size_ = 0;
     }
+    max_data_connections_ =
+        std::min(max_data_connections_, settings.max_data_connections());
+    // The chunk size policy only changes how we send, so it needs no
+    // agreement from the peer: it stays within max_send_chunk_size_.
+    if (adaptive_chunk_size_ && max_send_chunk_size_ != 0) {
+      chunk_size_policy_ = MakeRefCounted<ChunkSizePolicy>(
+          max_send_chunk_size_, encode_alignment_);
+    }
     return absl::OkStatus();
   }
 
   bool tracing_enabled_ = false;
+  bool adaptive_chunk_size_ = false;
+  bool pooled_receive_buffers_ = false;
   uint32_t encode_alignment_ = 64;
   uint32_t decode_alignment_ = 64;
   uint32_t max_send_chunk_size_ = 1024 * 1024;
   uint32_t max_recv_chunk_size_ = 1024 * 1024;
   uint32_t inline_payload_size_threshold_ = 8 * 1024;
+  uint32_t shared_memory_ring_size_ = 4 * 1024 * 1024;
+  uint32_t max_data_connections_ = 0;
   std::vector<PendingConnection> pending_data_endpoints_;
+  std::optional<PendingConnection> shared_memory_data_endpoint_;
+  std::string shared_memory_region_;
+  // The channel's quota, charged for the shared memory doorbell connection and
+  // for pooled receive buffers.
+  MemoryQuotaRefPtr memory_quota_;
+  RefCountedPtr<ChunkSizePolicy> chunk_size_policy_;
   absl::flat_hash_set<chaotic_good_frame::Settings::Features>
       supported_features_;
 };
@@ -14,9 +14,13 @@
 
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
+#include <utility>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/strings/escaping.h"
@@ -25,7 +29,10 @@
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_seq.h"
 
@@ -35,15 +42,50 @@ namespace chaotic_good {
 namespace data_endpoints_detail {
 
 ///////////////////////////////////////////////////////////////////////////////
-// OutputBuffer
+// WriteLoad
 
-bool OutputBuffer::Accept(SliceBuffer& buffer) {
-  if (pending_.Length() != 0 &&
-      pending_.Length() + buffer.Length() > pending_max_) {
-    return false;
+void WriteLoad::EndWrite(bool ok, Clock::time_point now) {
+  busy_nanos_ += std::chrono::duration<double, std::nano>(
+                     now - std::max(write_start_, busy_mark_))
+                     .count();
+  const size_t bytes = std::exchange(in_flight_bytes_, 0);
+  if (!ok) {
+    failed_ = true;
+    return;
+  }
+  if (bytes < kMinSampleBytes) return;
+  const double sample =
+      std::chrono::duration<double, std::nano>(now - write_start_).count() /
+      bytes;
+  if (nanos_per_byte_ < 0) {
+    nanos_per_byte_ = sample;
+  } else {
+    nanos_per_byte_ = 0.75 * nanos_per_byte_ + 0.25 * sample;
   }
-  pending_.Append(buffer);
-  return true;
+}
+
+double WriteLoad::EstimatedDelayNanos(size_t queued_bytes,
+                                      Clock::time_point now,
+                                      double default_nanos_per_byte) const {
+  double nanos_per_byte =
+      nanos_per_byte_ < 0 ? default_nanos_per_byte : nanos_per_byte_;
+  if (in_flight_bytes_ != 0) {
+    const double elapsed =
+        std::chrono::duration<double, std::nano>(now - write_start_).count();
+    nanos_per_byte = std::max(nanos_per_byte, elapsed / in_flight_bytes_);
+  }
+  return static_cast<double>(queued_bytes + in_flight_bytes_) * nanos_per_byte;
+}
+
+double WriteLoad::TakeBusyNanos(Clock::time_point now) {
+  double busy_nanos = std::exchange(busy_nanos_, 0);
+  if (in_flight_bytes_ != 0) {
+    busy_nanos += std::chrono::duration<double, std::nano>(
+                      now - std::max(write_start_, busy_mark_))
+                      .count();
+  }
+  busy_mark_ = now;
+  return busy_nanos;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,16 +95,50 @@ Poll<uint32_t> OutputBuffers::PollWrite(SliceBuffer& output_buffer) {
   Waker waker;
   auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
   const auto length = output_buffer.Length();
+  const auto now = WriteLoad::Clock::now();
   MutexLock lock(&mu_);
+  // Unmeasured endpoints are assumed to be as fast as the fastest measured one
+  // so that they get tried; with no measurements at all this degenerates to
+  // picking the endpoint with the fewest queued bytes.
+  double default_nanos_per_byte = 1.0;
+  double slowest_nanos_per_byte = 0;
+  bool have_measurement = false;
+  for (const auto& buffer : buffers_) {
+    if (!buffer.has_value() || buffer->retired() || buffer->load().failed()) {
+      continue;
+    }
+    auto nanos_per_byte = buffer->load().nanos_per_byte();
+    if (!nanos_per_byte.has_value()) continue;
+    if (!have_measurement || *nanos_per_byte < default_nanos_per_byte) {
+      default_nanos_per_byte = *nanos_per_byte;
+    }
+    slowest_nanos_per_byte = std::max(slowest_nanos_per_byte, *nanos_per_byte);
+    have_measurement = true;
+  }
+  if (have_measurement && default_nanos_per_byte > 0) {
+    throughput_skew_.store(slowest_nanos_per_byte / default_nanos_per_byte,
+                           std::memory_order_relaxed);
+  }
+  std::optional<size_t> best;
+  double best_delay = 0;
   for (size_t i = 0; i < buffers_.size(); ++i) {
-    if (buffers_[i].has_value() && buffers_[i]->Accept(output_buffer)) {
-      GRPC_TRACE_LOG(chaotic_good, INFO)
-          << "CHAOTIC_GOOD: Queue " << length << " data onto endpoint " << i
-          << " queue " << this;
-      waker = buffers_[i]->TakeWaker();
-      return i;
+    if (!buffers_[i].has_value() || !buffers_[i]->CanAccept(length)) continue;
+    const double delay = buffers_[i]->load().EstimatedDelayNanos(
+        buffers_[i]->pending_bytes() + length, now, default_nanos_per_byte);
+    if (!best.has_value() || delay < best_delay) {
+      best = i;
+      best_delay = delay;
     }
   }
+  if (best.has_value()) {
+    const size_t i = *best;
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Queue " << length << " data onto endpoint " << i
+        << " queue " << this << " estimated delay " << best_delay << "ns";
+    buffers_[i]->Accept(output_buffer);
+    waker = buffers_[i]->TakeWaker();
+    return i;
+  }
   GRPC_TRACE_LOG(chaotic_good, INFO)
       << "CHAOTIC_GOOD: No data endpoint ready for " << length
       << " bytes on queue " << this;
@@ -70,7 +146,8 @@ Poll<uint32_t> OutputBuffers::PollWrite(SliceBuffer& output_buffer) {
   return Pending{};
 }
 
-Poll<SliceBuffer> OutputBuffers::PollNext(uint32_t connection_id) {
+Poll<std::optional<SliceBuffer>> OutputBuffers::PollNext(
+    uint32_t connection_id) {
   Waker waker;
   auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
   MutexLock lock(&mu_);
@@ -78,8 +155,11 @@ Poll<SliceBuffer> OutputBuffers::PollNext(uint32_t connection_id) {
   CHECK(buffer.has_value());
   if (buffer->HavePending()) {
     waker = std::move(write_waker_);
+    buffer->load().BeginWrite(buffer->pending_bytes(),
+                              WriteLoad::Clock::now());
     return buffer->TakePending();
   }
+  if (buffer->retired()) return std::nullopt;
   buffer->SetWaker();
   return Pending{};
 }
@@ -91,12 +171,89 @@ void OutputBuffers::AddEndpoint(uint32_t connection_id) {
   if (buffers_.size() < connection_id + 1) {
     buffers_.resize(connection_id + 1);
   }
-  CHECK(!buffers_[connection_id].has_value()) << GRPC_DUMP_ARGS(connection_id);
-  buffers_[connection_id].emplace();
+  auto& buffer = buffers_[connection_id];
+  // Retired before it connected: the write loop will finish straight away.
+  if (buffer.has_value() && buffer->retired()) return;
+  CHECK(!buffer.has_value()) << GRPC_DUMP_ARGS(connection_id);
+  buffer.emplace();
   waker = std::move(write_waker_);
   ready_endpoints_.fetch_add(1, std::memory_order_relaxed);
 }
 
+void OutputBuffers::WriteCompleted(uint32_t connection_id, bool ok) {
+  MutexLock lock(&mu_);
+  auto& buffer = buffers_[connection_id];
+  CHECK(buffer.has_value());
+  buffer->load().EndWrite(ok, WriteLoad::Clock::now());
+}
+
+void OutputBuffers::Retire(uint32_t connection_id) {
+  Waker waker;
+  auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
+  MutexLock lock(&mu_);
+  if (buffers_.size() < connection_id + 1) {
+    buffers_.resize(connection_id + 1);
+  }
+  auto& buffer = buffers_[connection_id];
+  if (!buffer.has_value()) {
+    buffer.emplace();
+  } else if (!buffer->retired()) {
+    ready_endpoints_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Retire data endpoint " << connection_id << " queue "
+      << this;
+  buffer->Retire();
+  waker = buffer->TakeWaker();
+}
+
+void OutputBuffers::Keep(uint32_t connection_id) {
+  MutexLock lock(&mu_);
+  kept_.push_back(connection_id);
+}
+
+std::optional<uint32_t> OutputBuffers::EndpointToRetire() {
+  MutexLock lock(&mu_);
+  std::optional<uint32_t> worst;
+  double worst_nanos_per_byte = 0;
+  size_t ready = 0;
+  for (size_t i = 0; i < buffers_.size(); ++i) {
+    const auto& buffer = buffers_[i];
+    if (!buffer.has_value() || buffer->retired() || buffer->load().failed()) {
+      continue;
+    }
+    ++ready;
+    if (std::find(kept_.begin(), kept_.end(), i) != kept_.end()) continue;
+    const double nanos_per_byte = buffer->load().nanos_per_byte().value_or(0);
+    if (!worst.has_value() || nanos_per_byte >= worst_nanos_per_byte) {
+      worst = i;
+      worst_nanos_per_byte = nanos_per_byte;
+    }
+  }
+  if (ready < 2) return std::nullopt;
+  return worst;
+}
+
+double OutputBuffers::TakeUtilization() {
+  const auto now = WriteLoad::Clock::now();
+  MutexLock lock(&mu_);
+  const double elapsed =
+      std::chrono::duration<double, std::nano>(now - utilization_mark_)
+          .count();
+  utilization_mark_ = now;
+  double busy_nanos = 0;
+  size_t ready = 0;
+  for (auto& buffer : buffers_) {
+    if (!buffer.has_value()) continue;
+    const double endpoint_busy_nanos = buffer->load().TakeBusyNanos(now);
+    if (buffer->retired() || buffer->load().failed()) continue;
+    busy_nanos += endpoint_busy_nanos;
+    ++ready;
+  }
+  if (ready == 0 || elapsed <= 0) return 0;
+  return std::min(1.0, busy_nanos / (elapsed * ready));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // InputQueues
 
@@ -111,6 +268,10 @@ absl::StatusOr<uint64_t> InputQueues::CreateTicket(uint32_t connection_id,
     return absl::UnavailableError(
         absl::StrCat("Invalid connection id: ", connection_id));
   }
+  if (retired_[connection_id]) {
+    return absl::UnavailableError(
+        absl::StrCat("Read from retired connection id: ", connection_id));
+  }
   uint64_t ticket = next_ticket_id_;
   ++next_ticket_id_;
   auto r = ReadRequest{length, ticket};
@@ -138,11 +299,12 @@ Poll<absl::StatusOr<SliceBuffer>> InputQueues::PollRead(uint64_t ticket) {
   return result;
 }
 
-Poll<std::vector<InputQueues::ReadRequest>> InputQueues::PollNext(
-    uint32_t connection_id) {
+Poll<std::optional<std::vector<InputQueues::ReadRequest>>>
+InputQueues::PollNext(uint32_t connection_id) {
   MutexLock lock(&mu_);
   auto& q = read_requests_[connection_id];
   if (q.empty()) {
+    if (retired_[connection_id]) return std::nullopt;
     read_request_waker_[connection_id] =
         GetContext<Activity>()->MakeNonOwningWaker();
     return Pending{};
@@ -176,9 +338,19 @@ void InputQueues::AddEndpoint(uint32_t connection_id) {
   if (read_requests_.size() <= connection_id) {
     read_requests_.resize(connection_id + 1);
     read_request_waker_.resize(connection_id + 1);
+    retired_.resize(connection_id + 1);
   }
 }
 
+void InputQueues::Retire(uint32_t connection_id) {
+  Waker waker;
+  auto cleanup = absl::MakeCleanup([&waker]() { waker.Wakeup(); });
+  MutexLock lock(&mu_);
+  CHECK_LT(connection_id, retired_.size());
+  retired_[connection_id] = true;
+  waker = std::move(read_request_waker_[connection_id]);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Endpoint
 
@@ -188,49 +360,85 @@ auto Endpoint::WriteLoop(uint32_t id,
   output_buffers->AddEndpoint(id);
   return Loop([id, endpoint = std::move(endpoint),
                output_buffers = std::move(output_buffers)]() {
-    return TrySeq(
+    return Seq(
         output_buffers->Next(id),
-        [endpoint, id](SliceBuffer buffer) {
-          GRPC_TRACE_LOG(chaotic_good, INFO)
-              << "CHAOTIC_GOOD: Write " << buffer.Length()
-              << "b to data endpoint #" << id;
-          return endpoint->Write(std::move(buffer));
-        },
-        []() -> LoopCtl<absl::Status> { return Continue{}; });
+        [endpoint, id, output_buffers](std::optional<SliceBuffer> buffer) {
+          return If(
+              buffer.has_value(),
+              [&]() {
+                GRPC_TRACE_LOG(chaotic_good, INFO)
+                    << "CHAOTIC_GOOD: Write " << buffer->Length()
+                    << "b to data endpoint #" << id;
+                return Map(endpoint->Write(std::move(*buffer)),
+                           [id, output_buffers](
+                               absl::Status status) -> LoopCtl<absl::Status> {
+                             output_buffers->WriteCompleted(id, status.ok());
+                             if (!status.ok()) return status;
+                             return Continue{};
+                           });
+              },
+              [id]() -> LoopCtl<absl::Status> {
+                GRPC_TRACE_LOG(chaotic_good, INFO)
+                    << "CHAOTIC_GOOD: Data endpoint #" << id
+                    << " retired for writes";
+                return absl::OkStatus();
+              });
+        });
   });
 }
 
 auto Endpoint::ReadLoop(uint32_t id, RefCountedPtr<InputQueues> input_queues,
-                        std::shared_ptr<PromiseEndpoint> endpoint) {
-  return Loop([id, endpoint, input_queues = std::move(input_queues)]() {
-    return TrySeq(
+                        std::shared_ptr<PromiseEndpoint> endpoint,
+                        RefCountedPtr<ReceiveBufferPool> receive_buffers) {
+  return Loop([id, endpoint, input_queues = std::move(input_queues),
+               receive_buffers = std::move(receive_buffers)]() {
+    return Seq(
         input_queues->Next(id),
-        [endpoint, input_queues](
-            std::vector<data_endpoints_detail::InputQueues::ReadRequest>
+        [endpoint, id, input_queues, receive_buffers](
+            std::optional<
+                std::vector<data_endpoints_detail::InputQueues::ReadRequest>>
                 requests) {
-          return TrySeqContainer(
-              std::move(requests), Empty{},
-              [endpoint, input_queues](
-                  data_endpoints_detail::InputQueues::ReadRequest read_request,
-                  Empty) {
-                return Seq(endpoint->Read(read_request.length),
-                           [ticket = read_request.ticket,
-
-                            input_queues](absl::StatusOr<SliceBuffer> buffer) {
-                             input_queues->CompleteRead(ticket,
-                                                        std::move(buffer));
-                             return Empty{};
-                           });
+          return If(
+              requests.has_value(),
+              [&]() {
+                return Map(
+                    TrySeqContainer(
+                        std::move(*requests), Empty{},
+                        [endpoint, input_queues, receive_buffers](
+                            data_endpoints_detail::InputQueues::ReadRequest
+                                read_request,
+                            Empty) {
+                          return Seq(endpoint->Read(read_request.length),
+                                     [ticket = read_request.ticket,
+                                      input_queues, receive_buffers](
+                                         absl::StatusOr<SliceBuffer> buffer) {
+                                       if (receive_buffers != nullptr &&
+                                           buffer.ok()) {
+                                         buffer = receive_buffers->Gather(
+                                             std::move(*buffer));
+                                       }
+                                       input_queues->CompleteRead(
+                                           ticket, std::move(buffer));
+                                       return Empty{};
+                                     });
+                        }),
+                    [](auto) -> LoopCtl<absl::Status> { return Continue{}; });
+              },
+              [id]() -> LoopCtl<absl::Status> {
+                GRPC_TRACE_LOG(chaotic_good, INFO)
+                    << "CHAOTIC_GOOD: Data endpoint #" << id
+                    << " retired for reads";
+                return absl::OkStatus();
               });
-        },
-        []() -> LoopCtl<absl::Status> { return Continue{}; });
+        });
   });
 }
 
 Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
                    RefCountedPtr<InputQueues> input_queues,
                    PendingConnection pending_connection, bool enable_tracing,
-                   grpc_event_engine::experimental::EventEngine* event_engine) {
+                   grpc_event_engine::experimental::EventEngine* event_engine,
+                   RefCountedPtr<ReceiveBufferPool> receive_buffers) {
   input_queues->AddEndpoint(id);
   auto arena = SimpleArenaAllocator(0)->MakeArena();
   arena->SetContext(event_engine);
@@ -240,11 +448,13 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
       [id, enable_tracing, output_buffers = std::move(output_buffers),
        input_queues = std::move(input_queues),
        pending_connection = std::move(pending_connection),
+       receive_buffers = std::move(receive_buffers),
        arena = std::move(arena)]() mutable {
         return TrySeq(
             pending_connection.Await(),
             [id, enable_tracing, output_buffers = std::move(output_buffers),
              input_queues = std::move(input_queues),
+             receive_buffers = std::move(receive_buffers),
              arena = std::move(arena)](PromiseEndpoint ep) mutable {
               GRPC_TRACE_LOG(chaotic_good, INFO)
                   << "CHAOTIC_GOOD: data endpoint " << id << " to "
@@ -264,15 +474,31 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
                 if (epte != nullptr) epte->InitializeAndReturnTcpTracer();
               }
               auto read_party = Party::Make(std::move(arena));
+              auto read_done = std::make_shared<InterActivityLatch<void>>();
               read_party->Spawn(
                   "read",
-                  [id, input_queues = std::move(input_queues), endpoint]() {
-                    return ReadLoop(id, input_queues, endpoint);
+                  [id, input_queues = std::move(input_queues), endpoint,
+                   receive_buffers = std::move(receive_buffers)]() {
+                    return ReadLoop(id, input_queues, endpoint,
+                                    receive_buffers);
                   },
-                  [](absl::Status) {});
-              return Map(
+                  [read_done](absl::Status) { read_done->Set(); });
+              // A retired endpoint finishes writing before it finishes
+              // reading: keep the read party alive until then. The endpoint
+              // is closed when both loops have released it.
+              return Seq(
                   WriteLoop(id, std::move(output_buffers), std::move(endpoint)),
-                  [read_party](auto x) { return x; });
+                  [read_party, read_done](absl::Status status) {
+                    return If(
+                        status.ok(),
+                        [&]() {
+                          return Map(read_done->Wait(),
+                                     [read_party, read_done](Empty) {
+                                       return absl::OkStatus();
+                                     });
+                        },
+                        [&]() { return Immediate(std::move(status)); });
+                  });
             });
       },
       [](absl::Status) {});
@@ -286,15 +512,76 @@ Endpoint::Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
 DataEndpoints::DataEndpoints(
     std::vector<PendingConnection> endpoints_vec,
     grpc_event_engine::experimental::EventEngine* event_engine,
-    bool enable_tracing)
+    bool enable_tracing, ReceiveBufferPool::Options receive_buffers)
     : output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>()),
-      input_queues_(MakeRefCounted<data_endpoints_detail::InputQueues>()) {
+      input_queues_(MakeRefCounted<data_endpoints_detail::InputQueues>()),
+      event_engine_(event_engine),
+      enable_tracing_(enable_tracing),
+      receive_buffers_(receive_buffers) {
   CHECK(event_engine != nullptr);
+  MutexLock lock(&mu_);
   for (size_t i = 0; i < endpoints_vec.size(); ++i) {
-    endpoints_.emplace_back(i, output_buffers_, input_queues_,
-                            std::move(endpoints_vec[i]), enable_tracing,
-                            event_engine);
+    EmplaceEndpoint(i, std::move(endpoints_vec[i]));
+  }
+}
+
+uint32_t DataEndpoints::AddEndpoint(PendingConnection pending_connection) {
+  MutexLock lock(&mu_);
+  const uint32_t id = endpoints_.size();
+  EmplaceEndpoint(id, std::move(pending_connection));
+  return id;
+}
+
+data_endpoints_detail::Endpoint& DataEndpoints::EmplaceEndpoint(
+    uint32_t id, PendingConnection pending_connection) {
+  RefCountedPtr<ReceiveBufferPool> receive_buffers;
+  if (receive_buffers_.buffer_size != 0) {
+    receive_buffers = MakeRefCounted<ReceiveBufferPool>(receive_buffers_);
+  }
+  return endpoints_.emplace_back(id, output_buffers_, input_queues_,
+                                 std::move(pending_connection),
+                                 enable_tracing_, event_engine_,
+                                 std::move(receive_buffers));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// DataEndpointScaler
+
+DataEndpointScaler::Action DataEndpointScaler::Sample(uint32_t ready_endpoints,
+                                                      double utilization) {
+  // An endpoint we asked for connected, however late.
+  if (ready_endpoints > last_ready_endpoints_) unconnected_adds_ = 0;
+  last_ready_endpoints_ = ready_endpoints;
+  if (ready_endpoints < expected_endpoints_) {
+    // Give a new endpoint a few samples to connect before deciding anything
+    // else; if it never does, carry on without it.
+    if (++waiting_samples_ < kScaleUpSamples) return Action::kNone;
+    ++unconnected_adds_;
+  }
+  expected_endpoints_ = ready_endpoints;
+  waiting_samples_ = 0;
+  if (utilization >= kScaleUpUtilization) {
+    ++busy_samples_;
+    idle_samples_ = 0;
+  } else if (utilization <= kScaleDownUtilization) {
+    ++idle_samples_;
+    busy_samples_ = 0;
+  } else {
+    busy_samples_ = 0;
+    idle_samples_ = 0;
+  }
+  if (busy_samples_ >= kScaleUpSamples && ready_endpoints < max_endpoints_ &&
+      unconnected_adds_ < kMaxUnconnectedAdds) {
+    busy_samples_ = 0;
+    expected_endpoints_ = ready_endpoints + 1;
+    return Action::kAdd;
+  }
+  if (idle_samples_ >= kScaleDownSamples && ready_endpoints > min_endpoints_) {
+    idle_samples_ = 0;
+    expected_endpoints_ = ready_endpoints - 1;
+    return Action::kRetire;
   }
+  return Action::kNone;
 }
 
 }  // namespace chaotic_good
@@ -16,9 +16,12 @@
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_DATA_ENDPOINTS_H
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <optional>
 
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/receive_buffer_pool.h"
 #include "src/core/lib/promise/party.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/slice/slice_buffer.h"
@@ -29,21 +32,84 @@ namespace chaotic_good {
 
 namespace data_endpoints_detail {
 
+// Tracks how quickly one data endpoint drains writes, so that new chunks can
+// be placed on the endpoint expected to deliver them soonest.
+class WriteLoad {
+ public:
+  // Not Timestamp: a write into the kernel's send buffer usually completes in
+  // well under a millisecond, which Timestamp (millisecond ticks, cached per
+  // ExecCtx) would round down to nothing.
+  using Clock = std::chrono::steady_clock;
+
+  // Writes smaller than this are dominated by per-write overhead and say little
+  // about the endpoint's throughput, so they don't update the estimate.
+  static constexpr size_t kMinSampleBytes = 16 * 1024;
+
+  void BeginWrite(size_t bytes, Clock::time_point now) {
+    in_flight_bytes_ = bytes;
+    write_start_ = now;
+  }
+  void EndWrite(bool ok, Clock::time_point now);
+
+  // Estimated time (in nanoseconds) until `queued_bytes` more bytes would be
+  // written by this endpoint. Endpoints without an estimate yet are assumed to
+  // write at `default_nanos_per_byte`.
+  // An outstanding write that is taking longer than expected lowers the
+  // estimated rate immediately, so a stalled endpoint stops attracting new
+  // chunks before that write finishes.
+  double EstimatedDelayNanos(size_t queued_bytes, Clock::time_point now,
+                             double default_nanos_per_byte) const;
+
+  // Nanoseconds this endpoint has spent with a write outstanding since the
+  // previous call.
+  double TakeBusyNanos(Clock::time_point now);
+
+  std::optional<double> nanos_per_byte() const {
+    if (nanos_per_byte_ < 0) return std::nullopt;
+    return nanos_per_byte_;
+  }
+  bool failed() const { return failed_; }
+
+ private:
+  size_t in_flight_bytes_ = 0;
+  Clock::time_point write_start_;
+  // Busy time accumulated since busy_mark_.
+  double busy_nanos_ = 0;
+  Clock::time_point busy_mark_;
+  // Exponentially weighted moving average; negative until measured.
+  double nanos_per_byte_ = -1;
+  bool failed_ = false;
+};
+
 // Buffered writes for one data endpoint
 class OutputBuffer {
  public:
-  bool Accept(SliceBuffer& buffer);
+  bool CanAccept(size_t length) const {
+    return !retired_ && !load_.failed() &&
+           (pending_.Length() == 0 ||
+            pending_.Length() + length <= pending_max_);
+  }
+  void Accept(SliceBuffer& buffer) { pending_.Append(buffer); }
   Waker TakeWaker() { return std::move(flush_waker_); }
   void SetWaker() {
     flush_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
   }
   bool HavePending() const { return pending_.Length() > 0; }
+  size_t pending_bytes() const { return pending_.Length(); }
   SliceBuffer TakePending() { return std::move(pending_); }
+  WriteLoad& load() { return load_; }
+  const WriteLoad& load() const { return load_; }
+  // A retired buffer accepts no new writes; its endpoint's write loop ends
+  // once what is already queued has been written.
+  void Retire() { retired_ = true; }
+  bool retired() const { return retired_; }
 
  private:
   Waker flush_waker_;
+  bool retired_ = false;
   size_t pending_max_ = 1024 * 1024;
   SliceBuffer pending_;
+  WriteLoad load_;
 };
 
 // The set of output buffers for all connected data endpoints
@@ -60,19 +126,45 @@ class OutputBuffers : public RefCounted<OutputBuffers> {
   }
 
   void AddEndpoint(uint32_t connection_id);
+  // Called by the endpoint's write loop when the write of the buffer returned
+  // by Next completes.
+  void WriteCompleted(uint32_t connection_id, bool ok);
+  // Stop scheduling writes onto an endpoint. Next(connection_id) resolves to
+  // nullopt once everything already queued on it has been taken.
+  // The endpoint need not have been added yet.
+  void Retire(uint32_t connection_id);
+  // Never offer an endpoint from EndpointToRetire.
+  // The endpoint need not have been added yet.
+  void Keep(uint32_t connection_id);
+  // The ready endpoint to retire first when shrinking: the slowest measured
+  // one, or the most recently added if none are measured. Kept endpoints are
+  // never chosen. Nullopt if fewer than two endpoints are ready.
+  std::optional<uint32_t> EndpointToRetire();
+  // Average fraction of time ready endpoints spent writing since the previous
+  // call.
+  double TakeUtilization();
 
   uint32_t ReadyEndpoints() const {
     return ready_endpoints_.load(std::memory_order_relaxed);
   }
+  // Ratio between the slowest and fastest measured endpoint write rates (1 if
+  // fewer than two endpoints have been measured).
+  double ThroughputSkew() const {
+    return throughput_skew_.load(std::memory_order_relaxed);
+  }
 
  private:
   Poll<uint32_t> PollWrite(SliceBuffer& output_buffer);
-  Poll<SliceBuffer> PollNext(uint32_t connection_id);
+  Poll<std::optional<SliceBuffer>> PollNext(uint32_t connection_id);
 
   Mutex mu_;
   std::vector<std::optional<OutputBuffer>> buffers_ ABSL_GUARDED_BY(mu_);
   Waker write_waker_ ABSL_GUARDED_BY(mu_);
+  std::vector<uint32_t> kept_ ABSL_GUARDED_BY(mu_);
+  WriteLoad::Clock::time_point utilization_mark_ ABSL_GUARDED_BY(mu_) =
+      WriteLoad::Clock::now();
   std::atomic<uint32_t> ready_endpoints_{0};
+  std::atomic<double> throughput_skew_{1.0};
 };
 
 class InputQueues : public RefCounted<InputQueues> {
@@ -151,17 +243,23 @@ class InputQueues : public RefCounted<InputQueues> {
   void CancelTicket(uint64_t ticket);
 
   void AddEndpoint(uint32_t connection_id);
+  // No further reads will be requested from an endpoint: Next(connection_id)
+  // resolves to nullopt once the outstanding requests have been taken, and new
+  // tickets for it fail.
+  void Retire(uint32_t connection_id);
 
  private:
   using ReadState = std::variant<absl::StatusOr<SliceBuffer>, Waker>;
 
   absl::StatusOr<uint64_t> CreateTicket(uint32_t connection_id, size_t length);
   Poll<absl::StatusOr<SliceBuffer>> PollRead(uint64_t ticket);
-  Poll<std::vector<ReadRequest>> PollNext(uint32_t connection_id);
+  Poll<std::optional<std::vector<ReadRequest>>> PollNext(
+      uint32_t connection_id);
 
   Mutex mu_;
   uint64_t next_ticket_id_ ABSL_GUARDED_BY(mu_) = 0;
   std::vector<std::vector<ReadRequest>> read_requests_ ABSL_GUARDED_BY(mu_);
+  std::vector<bool> retired_ ABSL_GUARDED_BY(mu_);
   std::vector<Waker> read_request_waker_;
   absl::flat_hash_map<uint64_t, ReadState> outstanding_reads_
       ABSL_GUARDED_BY(mu_);
@@ -172,14 +270,18 @@ class Endpoint final {
   Endpoint(uint32_t id, RefCountedPtr<OutputBuffers> output_buffers,
            RefCountedPtr<InputQueues> input_queues,
            PendingConnection pending_connection, bool enable_tracing,
-           grpc_event_engine::experimental::EventEngine* event_engine);
+           grpc_event_engine::experimental::EventEngine* event_engine,
+           RefCountedPtr<ReceiveBufferPool> receive_buffers);
 
  private:
   static auto WriteLoop(uint32_t id,
                         RefCountedPtr<OutputBuffers> output_buffers,
                         std::shared_ptr<PromiseEndpoint> endpoint);
+  // If `receive_buffers` is non-null, each payload read is delivered in a
+  // single aligned buffer from it.
   static auto ReadLoop(uint32_t id, RefCountedPtr<InputQueues> input_queues,
-                       std::shared_ptr<PromiseEndpoint> endpoint);
+                       std::shared_ptr<PromiseEndpoint> endpoint,
+                       RefCountedPtr<ReceiveBufferPool> receive_buffers);
 
   RefCountedPtr<Party> party_;
 };
@@ -191,10 +293,12 @@ class DataEndpoints {
  public:
   using ReadTicket = data_endpoints_detail::InputQueues::ReadTicket;
 
+  // Each endpoint gets its own pool of receive buffers, unless
+  // `receive_buffers.buffer_size` is 0.
   explicit DataEndpoints(
       std::vector<PendingConnection> endpoints,
       grpc_event_engine::experimental::EventEngine* event_engine,
-      bool enable_tracing);
+      bool enable_tracing, ReceiveBufferPool::Options receive_buffers = {});
 
   // Try to queue output_buffer against a data endpoint.
   // Returns a promise that resolves to the data endpoint connection id
@@ -211,14 +315,91 @@ class DataEndpoints {
   }
 
   bool empty() const { return output_buffers_->ReadyEndpoints() == 0; }
+  uint32_t ready_endpoints() const { return output_buffers_->ReadyEndpoints(); }
+  double throughput_skew() const { return output_buffers_->ThroughputSkew(); }
+
+  // Add a data endpoint after construction; returns its connection id.
+  // Both peers must add endpoints in the same order so that ids agree.
+  uint32_t AddEndpoint(PendingConnection pending_connection);
+  // Retiring an endpoint is done in two halves, and the endpoint is closed
+  // once both have been done and its queued reads and writes have drained:
+  // - stop writing once we've decided (or been told) to retire it;
+  // - stop reading once the peer can no longer send us frames referencing it.
+  void StopWriting(uint32_t connection_id) {
+    output_buffers_->Retire(connection_id);
+  }
+  void StopReading(uint32_t connection_id) {
+    input_queues_->Retire(connection_id);
+  }
+  // Number of endpoints added so far, including retired ones.
+  uint32_t size() {
+    MutexLock lock(&mu_);
+    return endpoints_.size();
+  }
+  // Endpoints that can't be added back once retired (the shared memory
+  // endpoint) must be kept, so that scaling down never loses them.
+  void KeepEndpoint(uint32_t connection_id) {
+    output_buffers_->Keep(connection_id);
+  }
+  std::optional<uint32_t> EndpointToRetire() {
+    return output_buffers_->EndpointToRetire();
+  }
+  double TakeUtilization() { return output_buffers_->TakeUtilization(); }
 
  private:
+  data_endpoints_detail::Endpoint& EmplaceEndpoint(
+      uint32_t id, PendingConnection pending_connection)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   RefCountedPtr<data_endpoints_detail::OutputBuffers> output_buffers_;
   RefCountedPtr<data_endpoints_detail::InputQueues> input_queues_;
+  grpc_event_engine::experimental::EventEngine* const event_engine_;
+  const bool enable_tracing_;
+  const ReceiveBufferPool::Options receive_buffers_;
   Mutex mu_;
   std::vector<data_endpoints_detail::Endpoint> endpoints_ ABSL_GUARDED_BY(mu_);
 };
 
+// Decides when a connection should add or retire data endpoints, from
+// periodic samples of how busy its ready endpoints have been.
+class DataEndpointScaler {
+ public:
+  enum class Action { kNone, kAdd, kRetire };
+
+  // Average endpoint utilization above which we want another endpoint, and
+  // below which we can do with one fewer. The gap between them keeps the count
+  // from flapping: retiring one of n endpoints at most doubles the utilization
+  // of the rest.
+  static constexpr double kScaleUpUtilization = 0.75;
+  static constexpr double kScaleDownUtilization = 0.25;
+  // Consecutive samples a condition must hold for before acting on it.
+  // Shrinking waits longer: reconnecting costs more than keeping an idle
+  // endpoint a little longer.
+  static constexpr int kScaleUpSamples = 3;
+  static constexpr int kScaleDownSamples = 10;
+  // Stop adding endpoints after this many in a row failed to connect, until
+  // one of them does connect: a peer that can't complete data connections
+  // would otherwise be asked for a new one every few samples.
+  static constexpr int kMaxUnconnectedAdds = 2;
+
+  DataEndpointScaler(uint32_t min_endpoints, uint32_t max_endpoints)
+      : min_endpoints_(min_endpoints), max_endpoints_(max_endpoints) {}
+
+  Action Sample(uint32_t ready_endpoints, double utilization);
+
+ private:
+  const uint32_t min_endpoints_;
+  const uint32_t max_endpoints_;
+  int busy_samples_ = 0;
+  int idle_samples_ = 0;
+  // Endpoint count we expect after our last action, and how many samples we
+  // have waited for a new endpoint to become ready.
+  uint32_t expected_endpoints_ = 0;
+  int waiting_samples_ = 0;
+  uint32_t last_ready_endpoints_ = 0;
+  int unconnected_adds_ = 0;
+};
+
 }  // namespace chaotic_good
 }  // namespace grpc_core
 
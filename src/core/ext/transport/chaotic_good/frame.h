@@ -181,10 +181,11 @@ struct MessageChunkFrame final : public FrameInterface {
 
 using ClientFrame =
     std::variant<ClientInitialMetadataFrame, MessageFrame, BeginMessageFrame,
-                 MessageChunkFrame, ClientEndOfStream, CancelFrame>;
+                 MessageChunkFrame, ClientEndOfStream, CancelFrame,
+                 SettingsFrame>;
 using ServerFrame =
     std::variant<ServerInitialMetadataFrame, MessageFrame, BeginMessageFrame,
-                 MessageChunkFrame, ServerTrailingMetadataFrame>;
+                 MessageChunkFrame, ServerTrailingMetadataFrame, SettingsFrame>;
 
 }  // namespace chaotic_good
 }  // namespace grpc_core
@@ -15,6 +15,8 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_CHUNKER_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_CHUNKER_H
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 
 #include "src/core/ext/transport/chaotic_good/frame.h"
@@ -22,6 +24,8 @@
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -84,23 +88,104 @@ class PayloadChunker {
 };
 }  // namespace message_chunker_detail
 
+// Picks the chunk size at runtime instead of always using the negotiated
+// maximum.
+// The target is the typical size of large messages divided by the number of
+// pieces wanted: one per ready data endpoint, and more when endpoint
+// throughputs differ, so that the faster endpoints can take a larger share.
+// Messages no larger than the chunk size are sent whole, so small messages
+// never pay for chunking. The chunk size only moves when the target drifts
+// more than 25% away from it, so it doesn't flap as traffic jitters.
+// Shared by all calls on a transport; all methods are thread safe.
+class ChunkSizePolicy : public RefCounted<ChunkSizePolicy> {
+ public:
+  // Smallest chunk the policy will choose (unless the negotiated maximum is
+  // smaller still).
+  static constexpr uint32_t kMinChunkSize = 64 * 1024;
+  // Most pieces a typical message is split into per data endpoint.
+  static constexpr uint32_t kMaxPiecesPerEndpoint = 4;
+
+  ChunkSizePolicy(uint32_t max_chunk_size, uint32_t alignment)
+      : max_chunk_size_(max_chunk_size),
+        min_chunk_size_(std::min(kMinChunkSize, max_chunk_size)),
+        alignment_(std::max<uint32_t>(alignment, 1)),
+        chunk_size_(max_chunk_size) {}
+
+  // Chunk size to use for a message of `length` bytes, or 0 if it should be
+  // sent whole. Also feeds the message size into the policy.
+  uint32_t ChunkSizeFor(size_t length) {
+    if (length > min_chunk_size_) {
+      const uint64_t old_avg =
+          large_message_avg_.load(std::memory_order_relaxed);
+      const uint64_t new_avg =
+          old_avg == 0 ? length : old_avg - old_avg / 8 + length / 8;
+      large_message_avg_.store(new_avg, std::memory_order_relaxed);
+      Update();
+    }
+    const uint32_t chunk_size = chunk_size_.load(std::memory_order_relaxed);
+    return length > chunk_size ? chunk_size : 0;
+  }
+
+  // Feedback from the transport: how many data endpoints are accepting
+  // writes, and the ratio between the slowest and fastest one's throughput.
+  void SetDataEndpoints(uint32_t ready_endpoints, double throughput_skew) {
+    uint32_t pieces = std::max<uint32_t>(ready_endpoints, 1);
+    pieces *= std::clamp<uint32_t>(
+        static_cast<uint32_t>(throughput_skew + 0.5), 1,
+        kMaxPiecesPerEndpoint);
+    if (pieces_.exchange(pieces, std::memory_order_relaxed) != pieces) {
+      Update();
+    }
+  }
+
+  uint32_t chunk_size() const {
+    return chunk_size_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  void Update() {
+    const uint64_t avg = large_message_avg_.load(std::memory_order_relaxed);
+    if (avg == 0) return;
+    uint64_t target = avg / pieces_.load(std::memory_order_relaxed);
+    target = (target + alignment_ - 1) / alignment_ * alignment_;
+    target = std::clamp<uint64_t>(target, min_chunk_size_, max_chunk_size_);
+    const uint32_t current = chunk_size_.load(std::memory_order_relaxed);
+    if (target * 4 > current * 5 || target * 5 < current * 4) {
+      chunk_size_.store(static_cast<uint32_t>(target),
+                        std::memory_order_relaxed);
+    }
+  }
+
+  const uint32_t max_chunk_size_;
+  const uint32_t min_chunk_size_;
+  const uint32_t alignment_;
+  std::atomic<uint32_t> chunk_size_;
+  std::atomic<uint32_t> pieces_{1};
+  // Moving average of the size of messages larger than min_chunk_size_.
+  std::atomic<uint64_t> large_message_avg_{0};
+};
+
 // Helper to send message payloads (possibly chunked!) between client & server.
 class MessageChunker {
  public:
-  MessageChunker(uint32_t max_chunk_size, uint32_t alignment)
-      : max_chunk_size_(max_chunk_size), alignment_(alignment) {}
+  MessageChunker(uint32_t max_chunk_size, uint32_t alignment,
+                 RefCountedPtr<ChunkSizePolicy> policy = nullptr)
+      : max_chunk_size_(max_chunk_size),
+        alignment_(alignment),
+        policy_(std::move(policy)) {}
 
   template <typename Output>
   auto Send(MessageHandle message, uint32_t stream_id, Output& output) {
+    const uint32_t chunk_size = ChunkSize(*message);
     return If(
-        ShouldChunk(*message),
+        chunk_size != 0,
         [&]() {
           BeginMessageFrame begin;
           begin.body.set_length(message->payload()->Length());
           begin.stream_id = stream_id;
           return Seq(output.Send(std::move(begin)),
                      Loop([chunker = message_chunker_detail::PayloadChunker(
-                               max_chunk_size_, alignment_, stream_id,
+                               chunk_size, alignment_, stream_id,
                                std::move(*message->payload())),
                            &output]() mutable {
                        auto next = chunker.NextChunk();
@@ -123,13 +208,17 @@ class MessageChunker {
   uint32_t alignment() const { return alignment_; }
 
  private:
-  bool ShouldChunk(Message& message) {
-    return max_chunk_size_ != 0 &&
-           message.payload()->Length() > max_chunk_size_;
+  // Chunk size for `message`, or 0 to send it unchunked.
+  uint32_t ChunkSize(Message& message) {
+    if (max_chunk_size_ == 0) return 0;
+    const size_t length = message.payload()->Length();
+    if (policy_ != nullptr) return policy_->ChunkSizeFor(length);
+    return length > max_chunk_size_ ? max_chunk_size_ : 0;
   }
 
   const uint32_t max_chunk_size_;
   const uint32_t alignment_;
+  const RefCountedPtr<ChunkSizePolicy> policy_;
 };
 
 }  // namespace chaotic_good
@@ -0,0 +1,132 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/receive_buffer_pool.h"
+
+#include <grpc/slice.h>
+#include <grpc/support/alloc.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/numeric/bits.h"
+#include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+namespace {
+size_t RoundUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+}  // namespace
+
+// Header at the start of every buffer allocation; serves as the refcount of
+// the slice that covers the rest of it.
+class ReceiveBufferPool::Buffer final : public grpc_slice_refcount {
+ public:
+  Buffer(RefCountedPtr<ReceiveBufferPool> pool, size_t capacity)
+      : grpc_slice_refcount(Destroy),
+        pool_(std::move(pool)),
+        capacity_(capacity) {}
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* buffer = static_cast<Buffer*>(p);
+    auto pool = std::move(buffer->pool_);
+    const size_t capacity = buffer->capacity_;
+    buffer->~Buffer();
+    pool->Release(buffer, capacity);
+  }
+
+  RefCountedPtr<ReceiveBufferPool> pool_;
+  const size_t capacity_;
+};
+
+ReceiveBufferPool::ReceiveBufferPool(Options options)
+    : buffer_size_(options.buffer_size),
+      alignment_(std::max(options.alignment, alignof(std::max_align_t))),
+      header_size_(RoundUp(sizeof(Buffer), alignment_)),
+      allocator_(options.memory_quota->CreateMemoryAllocator(
+          "chaotic_good_receive_buffers")) {
+  CHECK(absl::has_single_bit(options.alignment));
+}
+
+ReceiveBufferPool::~ReceiveBufferPool() {
+  for (void* memory : idle_) Free(memory, buffer_size_);
+}
+
+MutableSlice ReceiveBufferPool::Allocate(size_t length) {
+  // Small payloads would waste most of a pooled buffer for as long as the
+  // message is held, so they get one of their own.
+  const size_t capacity =
+      length <= buffer_size_ / 2 ? length : std::max(length, buffer_size_);
+  void* memory = nullptr;
+  if (capacity == buffer_size_) {
+    MutexLock lock(&mu_);
+    if (!idle_.empty()) {
+      memory = idle_.back();
+      idle_.pop_back();
+    }
+  }
+  if (memory == nullptr) {
+    allocator_.Reserve(MemoryRequest(header_size_ + capacity));
+    memory = gpr_malloc_aligned(header_size_ + capacity, alignment_);
+  }
+  grpc_slice slice;
+  slice.refcount = new (memory) Buffer(Ref(), capacity);
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(memory) + header_size_;
+  slice.data.refcounted.length = length;
+  return MutableSlice(slice);
+}
+
+SliceBuffer ReceiveBufferPool::Gather(SliceBuffer payload) {
+  if (payload.Count() == 1) {
+    const grpc_slice& slice = payload.c_slice_at(0);
+    if (slice.refcount != nullptr &&
+        reinterpret_cast<uintptr_t>(GRPC_SLICE_START_PTR(slice)) %
+                alignment_ ==
+            0) {
+      return payload;
+    }
+  }
+  if (payload.Length() == 0) return payload;
+  MutableSlice gathered = Allocate(payload.Length());
+  payload.MoveFirstNBytesIntoBuffer(payload.Length(), gathered.data());
+  return SliceBuffer(Slice(std::move(gathered)));
+}
+
+void ReceiveBufferPool::Release(void* memory, size_t capacity) {
+  if (capacity == buffer_size_) {
+    MutexLock lock(&mu_);
+    if (idle_.size() < kMaxIdleBuffers) {
+      idle_.push_back(memory);
+      return;
+    }
+  }
+  Free(memory, capacity);
+}
+
+void ReceiveBufferPool::Free(void* memory, size_t capacity) {
+  gpr_free_aligned(memory);
+  allocator_.Release(header_size_ + capacity);
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
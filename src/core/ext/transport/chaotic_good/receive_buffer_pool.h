@@ -0,0 +1,98 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_RECEIVE_BUFFER_POOL_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_RECEIVE_BUFFER_POOL_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Aligned, reusable buffers that received data frame payloads are copied into.
+//
+// Slices handed out by the pool start at an `alignment` boundary and, when
+// released, return their memory to the pool for the next payload instead of
+// to the allocator. The bookkeeping for each buffer lives in the same
+// allocation, so reusing a buffer allocates nothing.
+// Payloads larger than `buffer_size`, or no more than half of it, still get an
+// aligned buffer, but one sized to fit that is freed on release.
+// Every buffer the pool holds, in use or idle, is charged to `memory_quota`.
+//
+// Thread safe: slices may be released from any thread, and may outlive the
+// pool's owner.
+class ReceiveBufferPool : public RefCounted<ReceiveBufferPool> {
+ public:
+  struct Options {
+    // Size of pooled buffers; 0 disables pooling.
+    size_t buffer_size = 0;
+    // Must be a power of two.
+    size_t alignment = 64;
+    // Required if buffer_size is non-zero.
+    MemoryQuotaRefPtr memory_quota;
+  };
+
+  // Released buffers beyond this many are freed.
+  static constexpr size_t kMaxIdleBuffers = 4;
+
+  explicit ReceiveBufferPool(Options options);
+  ~ReceiveBufferPool() override;
+
+  ReceiveBufferPool(const ReceiveBufferPool&) = delete;
+  ReceiveBufferPool& operator=(const ReceiveBufferPool&) = delete;
+
+  // An aligned slice of `length` uninitialized bytes.
+  MutableSlice Allocate(size_t length);
+
+  // Return `payload` as a single aligned slice: as is if it already is one,
+  // otherwise copied into a buffer from the pool.
+  SliceBuffer Gather(SliceBuffer payload);
+
+  size_t buffer_size() const { return buffer_size_; }
+  size_t alignment() const { return alignment_; }
+  size_t idle_buffers() {
+    MutexLock lock(&mu_);
+    return idle_.size();
+  }
+
+ private:
+  class Buffer;
+
+  void Release(void* memory, size_t capacity);
+  void Free(void* memory, size_t capacity);
+
+  const size_t buffer_size_;
+  const size_t alignment_;
+  // Offset of the payload from the start of each allocation: the Buffer
+  // header, rounded up to keep the payload aligned.
+  const size_t header_size_;
+  MemoryAllocator allocator_;
+  Mutex mu_;
+  std::vector<void*> idle_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_RECEIVE_BUFFER_POOL_H
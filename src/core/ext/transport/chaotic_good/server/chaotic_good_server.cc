@@ -34,6 +34,7 @@
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/ext/transport/chaotic_good/server_transport.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
@@ -339,6 +340,26 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                         config.ServerAddPendingDataEndpoint(
                             data_connection_listener.RequestDataConnection());
                       }
+                      if (config.supports_shared_memory() &&
+                          PeerIsOnSameHost(self->connection_->endpoint_)) {
+                        auto region = SharedMemoryRegion::Create(
+                            config.shared_memory_ring_size());
+                        absl::Status status = region.status();
+                        if (region.ok()) {
+                          status = config.ServerAddSharedMemoryDataEndpoint(
+                              std::move(*region),
+                              self->connection_->args()
+                                  .GetDurationFromIntMillis(
+                                      GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS)
+                                  .value_or(kConnectionDeadline),
+                              self->connection_->listener_->event_engine_);
+                        }
+                        if (!status.ok()) {
+                          LOG(INFO) << "Not offering shared memory data "
+                                       "endpoint: "
+                                    << status;
+                        }
+                      }
                       self->data_.emplace<ControlConnection>(std::move(config));
                     }
                     return !frame.body.data_channel();
@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 
@@ -38,7 +39,10 @@
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/event_engine_wakeup_scheduler.h"
 #include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/switch.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -47,10 +51,16 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 namespace chaotic_good {
 
+namespace {
+// How often the server re-evaluates the number of data endpoints.
+constexpr Duration kDataEndpointScalingPeriod = Duration::Seconds(1);
+}  // namespace
+
 auto ChaoticGoodServerTransport::PushFrameIntoCall(RefCountedPtr<Stream> stream,
                                                    MessageFrame frame) {
   GRPC_TRACE_LOG(chaotic_good, INFO)
@@ -282,6 +292,18 @@ auto ChaoticGoodServerTransport::ReadOneFrame(
                   return DispatchFrame<ClientEndOfStream>(
                       std::move(transport), std::move(incoming_frame));
                 }),
+                Case<FrameType::kSettings>([&, this]() {
+                  return TrySeq(
+                      incoming_frame.Payload(),
+                      [this, transport = std::move(transport),
+                       header = incoming_frame.header()](
+                          SliceBuffer payload) -> absl::Status {
+                        auto frame = transport->DeserializeFrame<SettingsFrame>(
+                            header, std::move(payload));
+                        if (!frame.ok()) return frame.status();
+                        return ProcessSettings(*transport, frame->body);
+                      });
+                }),
                 Case<FrameType::kCancel>([&, this]() {
                   auto stream =
                       ExtractStream(incoming_frame.header().stream_id);
@@ -317,6 +339,90 @@ auto ChaoticGoodServerTransport::TransportReadLoop(
              }));
 }
 
+absl::Status ChaoticGoodServerTransport::ProcessSettings(
+    ChaoticGoodTransport& transport,
+    const chaotic_good_frame::Settings& settings) {
+  if (settings.connection_id_size() != 0) {
+    return absl::InternalError("Client cannot specify connection ids");
+  }
+  auto& data_endpoints = transport.data_endpoints();
+  for (const uint32_t connection_id : settings.retire_data_connection()) {
+    if (connection_id == 0 || connection_id > data_endpoints.size()) {
+      return absl::InternalError(
+          absl::StrCat("Retired unknown data connection ", connection_id));
+    }
+    // The client has stopped sending on this endpoint, and every frame it
+    // sent there was announced before this one: nothing more will arrive.
+    data_endpoints.StopReading(connection_id - 1);
+  }
+  return absl::OkStatus();
+}
+
+std::optional<SettingsFrame> ChaoticGoodServerTransport::ScaleDataEndpoints(
+    ChaoticGoodTransport& transport, DataEndpointScaler& scaler) {
+  auto& data_endpoints = transport.data_endpoints();
+  const uint32_t ready_endpoints = data_endpoints.ready_endpoints();
+  const double utilization = data_endpoints.TakeUtilization();
+  switch (scaler.Sample(ready_endpoints, utilization)) {
+    case DataEndpointScaler::Action::kNone:
+      return std::nullopt;
+    case DataEndpointScaler::Action::kAdd: {
+      auto pending_connection = connection_factory_->RequestDataConnection();
+      SettingsFrame frame;
+      frame.body.add_connection_id(pending_connection.id());
+      const uint32_t id =
+          data_endpoints.AddEndpoint(std::move(pending_connection));
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD " << this << " add data endpoint " << id
+          << " at utilization " << utilization << " of " << ready_endpoints;
+      return frame;
+    }
+    case DataEndpointScaler::Action::kRetire: {
+      auto id = data_endpoints.EndpointToRetire();
+      if (!id.has_value()) return std::nullopt;
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD " << this << " retire data endpoint " << *id
+          << " at utilization " << utilization << " of " << ready_endpoints;
+      // Frames already sent on the endpoint were announced ahead of the
+      // settings frame, so the client has seen them all by the time it reads
+      // it.
+      data_endpoints.StopWriting(*id);
+      SettingsFrame frame;
+      frame.body.add_retire_data_connection(*id + 1);
+      return frame;
+    }
+  }
+  GPR_UNREACHABLE_CODE(return std::nullopt);
+}
+
+auto ChaoticGoodServerTransport::DataEndpointScalingLoop(
+    RefCountedPtr<ChaoticGoodTransport> transport,
+    uint32_t max_data_endpoints) {
+  return Loop([this, transport = std::move(transport),
+               scaler = std::make_shared<DataEndpointScaler>(
+                   1, max_data_endpoints)]() {
+    return Seq(
+        Sleep(kDataEndpointScalingPeriod),
+        [this, transport, scaler](absl::Status) {
+          auto frame = ScaleDataEndpoints(*transport, *scaler);
+          return If(
+              frame.has_value(),
+              [&]() {
+                return Map(outgoing_frames_.MakeSender().Send(
+                               std::move(*frame)),
+                           [](bool ok) -> LoopCtl<absl::Status> {
+                             if (!ok) {
+                               return absl::UnavailableError(
+                                   "Transport closed.");
+                             }
+                             return Continue{};
+                           });
+              },
+              []() -> LoopCtl<absl::Status> { return Continue{}; });
+        });
+  });
+}
+
 auto ChaoticGoodServerTransport::OnTransportActivityDone(
     absl::string_view activity) {
   return [self = RefAsSubclass<ChaoticGoodServerTransport>(),
@@ -330,8 +436,11 @@ auto ChaoticGoodServerTransport::OnTransportActivityDone(
 
 ChaoticGoodServerTransport::ChaoticGoodServerTransport(
     const ChannelArgs& args, PromiseEndpoint control_endpoint, Config config,
-    RefCountedPtr<ServerConnectionFactory>)
-    : call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
+    RefCountedPtr<ServerConnectionFactory> connection_factory)
+    : connection_factory_(connection_factory == nullptr
+                              ? nullptr
+                              : connection_factory->WeakRef()),
+      call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
           args.GetObject<ResourceQuota>()
               ->memory_quota()
               ->CreateMemoryAllocator("chaotic-good"),
@@ -340,9 +449,16 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
           args.GetObjectRef<grpc_event_engine::experimental::EventEngine>()),
       outgoing_frames_(4),
       message_chunker_(config.MakeMessageChunker()) {
+  const bool shared_memory = config.has_shared_memory_data_endpoint();
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
       std::move(control_endpoint), config.TakePendingDataEndpoints(),
       event_engine_, config.MakeTransportOptions(), false);
+  // Scaling only ever adds connections through connection_factory_, so the
+  // shared memory endpoint would be gone for good if it were retired.
+  if (shared_memory) {
+    auto& data_endpoints = transport->data_endpoints();
+    data_endpoints.KeepEndpoint(data_endpoints.size() - 1);
+  }
   auto party_arena = SimpleArenaAllocator(0)->MakeArena();
   party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine_.get());
@@ -352,6 +468,12 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
       GRPC_LATENT_SEE_PROMISE("ServerTransportWriteLoop",
                               transport->TransportWriteLoop(outgoing_frames_)),
       OnTransportActivityDone("writer"));
+  if (config.max_data_connections() != 0 && connection_factory_ != nullptr) {
+    party_->Spawn(
+        "server-chaotic-data-endpoint-scaler",
+        DataEndpointScalingLoop(transport, config.max_data_connections()),
+        OnTransportActivityDone("data-endpoint-scaler"));
+  }
   party_->Spawn("server-chaotic-reader",
                 GRPC_LATENT_SEE_PROMISE("ServerTransportReadLoop",
                                         TransportReadLoop(transport)),
@@ -134,8 +134,20 @@ class ChaoticGoodServerTransport final : public ServerTransport {
   auto SendFrameAcked(ServerFrame frame,
                       MpscSender<ServerFrame> outgoing_frames,
                       CallInitiator call_initiator);
+  // Handle a settings frame received after the handshake.
+  absl::Status ProcessSettings(ChaoticGoodTransport& transport,
+                               const chaotic_good_frame::Settings& settings);
+  // Periodically add or retire data endpoints to match throughput demand.
+  auto DataEndpointScalingLoop(RefCountedPtr<ChaoticGoodTransport> transport,
+                               uint32_t max_data_endpoints);
+  // Take one scaling decision; returns the settings frame announcing it to the
+  // client, if any.
+  std::optional<SettingsFrame> ScaleDataEndpoints(
+      ChaoticGoodTransport& transport, DataEndpointScaler& scaler);
 
   RefCountedPtr<UnstartedCallDestination> call_destination_;
+  // Weak: must not keep the listener from shutting down.
+  const WeakRefCountedPtr<ServerConnectionFactory> connection_factory_;
   const RefCountedPtr<CallArenaAllocator> call_arena_allocator_;
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
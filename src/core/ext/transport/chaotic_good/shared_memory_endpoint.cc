@@ -0,0 +1,869 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <optional>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/event_engine_context.h"
+#include "src/core/lib/event_engine/memory_allocator_factory.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/sync.h"
+
+#ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+#ifdef GPR_LINUX
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grpc_core {
+namespace chaotic_good {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::MemoryQuotaBasedMemoryAllocatorFactory;
+using grpc_event_engine::experimental::MutableSlice;
+using grpc_event_engine::experimental::Slice;
+
+namespace shared_memory_detail {
+
+// Region names are generated by the server and echoed by the client; only
+// names with this prefix are ever opened.
+constexpr absl::string_view kNamePrefix = "/grpc_chaotic_good_";
+constexpr uint64_t kMagic = 0x6772706363677368;  // "grpccgsh"
+constexpr uint32_t kVersion = 2;
+constexpr size_t kCacheLine = 64;
+
+struct alignas(kCacheLine) Waiting {
+  std::atomic<uint32_t> value;
+};
+
+struct alignas(kCacheLine) Position {
+  std::atomic<uint64_t> value;
+};
+
+struct RingHeader {
+  Position write_pos;
+  Position read_pos;
+};
+
+struct RegionHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t ring_size;
+  std::atomic<uint32_t> client_attached;
+  std::atomic<uint32_t> closed;
+  // Indexed by the side that is waiting.
+  Waiting waiting[2];
+  // Indexed by the side that writes into it.
+  RingHeader ring[2];
+};
+
+// Both processes operate on these atomics through the same mapping, which is
+// only sound if they are lock free.
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+
+// Ring data starts on a page boundary after the header.
+constexpr size_t kHeaderSize = (sizeof(RegionHeader) + 4095) & ~size_t{4095};
+
+}  // namespace shared_memory_detail
+
+using shared_memory_detail::RegionHeader;
+
+namespace {
+
+size_t SideIndex(SharedMemoryRegion::Side side) {
+  return static_cast<size_t>(side);
+}
+
+SharedMemoryRegion::Side OtherSide(SharedMemoryRegion::Side side) {
+  return side == SharedMemoryRegion::Side::kServer
+             ? SharedMemoryRegion::Side::kClient
+             : SharedMemoryRegion::Side::kServer;
+}
+
+bool IsPowerOfTwo(uint32_t x) { return x != 0 && (x & (x - 1)) == 0; }
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryRegion
+
+SharedMemoryRegion::SharedMemoryRegion(std::string name, void* mapping,
+                                       size_t mapping_size, uint32_t ring_size,
+                                       bool owner)
+    : name_(std::move(name)),
+      mapping_(mapping),
+      mapping_size_(mapping_size),
+      ring_size_(ring_size),
+      unlinked_(!owner),
+      header_(static_cast<RegionHeader*>(mapping)) {}
+
+#ifdef GPR_LINUX
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> SharedMemoryRegion::Create(
+    uint32_t ring_size) {
+  if (!IsPowerOfTwo(ring_size)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Shared memory ring size must be a power of two: ",
+                     ring_size));
+  }
+  absl::BitGen bitgen;
+  const std::string name =
+      absl::StrCat(shared_memory_detail::kNamePrefix,
+                   absl::Hex(absl::Uniform<uint64_t>(bitgen),
+                             absl::kZeroPad16),
+                   absl::Hex(absl::Uniform<uint64_t>(bitgen),
+                             absl::kZeroPad16));
+  const int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", strerror(errno)));
+  }
+  const size_t mapping_size =
+      shared_memory_detail::kHeaderSize + 2 * static_cast<size_t>(ring_size);
+  if (ftruncate(fd, mapping_size) != 0) {
+    const int err = errno;
+    close(fd);
+    shm_unlink(name.c_str());
+    return absl::InternalError(
+        absl::StrCat("ftruncate(", name, "): ", strerror(err)));
+  }
+  void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return absl::InternalError(
+        absl::StrCat("mmap(", name, "): ", strerror(err)));
+  }
+  auto* header = new (mapping) RegionHeader();
+  header->version = shared_memory_detail::kVersion;
+  header->ring_size = ring_size;
+  header->magic = shared_memory_detail::kMagic;
+  return RefCountedPtr<SharedMemoryRegion>(new SharedMemoryRegion(
+      name, mapping, mapping_size, ring_size, /*owner=*/true));
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> SharedMemoryRegion::Attach(
+    absl::string_view name) {
+  if (!absl::StartsWith(name, shared_memory_detail::kNamePrefix) ||
+      name.find('/', 1) != absl::string_view::npos) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Invalid shared memory region name: ", name));
+  }
+  const std::string name_str(name);
+  const int fd = shm_open(name_str.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("shm_open(", name, "): ", strerror(errno)));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < shared_memory_detail::kHeaderSize) {
+    close(fd);
+    return absl::InternalError(
+        absl::StrCat("Shared memory region too small: ", name));
+  }
+  const size_t mapping_size = static_cast<size_t>(st.st_size);
+  void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return absl::InternalError(
+        absl::StrCat("mmap(", name, "): ", strerror(err)));
+  }
+  auto* header = static_cast<RegionHeader*>(mapping);
+  const uint32_t ring_size = header->ring_size;
+  if (header->magic != shared_memory_detail::kMagic ||
+      header->version != shared_memory_detail::kVersion ||
+      !IsPowerOfTwo(ring_size) ||
+      mapping_size != shared_memory_detail::kHeaderSize +
+                          2 * static_cast<size_t>(ring_size)) {
+    munmap(mapping, mapping_size);
+    return absl::InternalError(
+        absl::StrCat("Incompatible shared memory region: ", name));
+  }
+  uint32_t expected = 0;
+  if (!header->client_attached.compare_exchange_strong(expected, 1)) {
+    munmap(mapping, mapping_size);
+    return absl::FailedPreconditionError(
+        absl::StrCat("Shared memory region already attached: ", name));
+  }
+  return RefCountedPtr<SharedMemoryRegion>(new SharedMemoryRegion(
+      name_str, mapping, mapping_size, ring_size, /*owner=*/false));
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+  Unlink();
+  munmap(mapping_, mapping_size_);
+}
+
+void SharedMemoryRegion::Unlink() {
+  if (std::exchange(unlinked_, true)) return;
+  shm_unlink(name_.c_str());
+}
+
+#else  // !GPR_LINUX
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> SharedMemoryRegion::Create(
+    uint32_t) {
+  return absl::UnimplementedError(
+      "Shared memory data endpoints are only supported on Linux");
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> SharedMemoryRegion::Attach(
+    absl::string_view) {
+  return absl::UnimplementedError(
+      "Shared memory data endpoints are only supported on Linux");
+}
+
+// Regions are never constructed on this platform.
+SharedMemoryRegion::~SharedMemoryRegion() = default;
+void SharedMemoryRegion::Unlink() {}
+
+#endif  // GPR_LINUX
+
+bool SharedMemoryRegion::peer_attached() const {
+  return header_->client_attached.load(std::memory_order_acquire) != 0;
+}
+
+uint8_t* SharedMemoryRegion::RingData(Side side) const {
+  return static_cast<uint8_t*>(mapping_) + shared_memory_detail::kHeaderSize +
+         SideIndex(side) * ring_size_;
+}
+
+size_t SharedMemoryRegion::ReadableBytes(Side to) const {
+  const size_t ring = SideIndex(OtherSide(to));
+  const uint64_t queued =
+      header_->ring[ring].write_pos.value.load() - read_pos_[ring];
+  return queued <= ring_size_ ? queued : 0;
+}
+
+size_t SharedMemoryRegion::WritableBytes(Side from) const {
+  const size_t ring = SideIndex(from);
+  const uint64_t queued =
+      write_pos_[ring] - header_->ring[ring].read_pos.value.load();
+  return queued <= ring_size_ ? ring_size_ - queued : 0;
+}
+
+absl::StatusOr<size_t> SharedMemoryRegion::Write(
+    Side from, grpc_event_engine::experimental::SliceBuffer& data) {
+  const size_t ring = SideIndex(from);
+  const uint64_t write_pos = write_pos_[ring];
+  // Sequentially consistent, as is the store below, to pair with the
+  // SetWaiting/TakeWaiting handshake.
+  const uint64_t read_pos = header_->ring[ring].read_pos.value.load();
+  // The reader can never be ahead of us, or more than a ring behind; unsigned
+  // wraparound makes the first case fail the second check too.
+  if (read_pos < peer_read_pos_[ring] || write_pos - read_pos > ring_size_) {
+    return Corrupted("read position");
+  }
+  peer_read_pos_[ring] = read_pos;
+  const size_t n =
+      std::min<size_t>(data.Length(), ring_size_ - (write_pos - read_pos));
+  if (n == 0) return 0;
+  uint8_t* base = RingData(from);
+  const size_t offset = write_pos & (ring_size_ - 1);
+  const size_t first = std::min<size_t>(n, ring_size_ - offset);
+  data.MoveFirstNBytesIntoBuffer(first, base + offset);
+  if (first < n) data.MoveFirstNBytesIntoBuffer(n - first, base);
+  write_pos_[ring] = write_pos + n;
+  header_->ring[ring].write_pos.value.store(write_pos + n);
+  return n;
+}
+
+absl::StatusOr<size_t> SharedMemoryRegion::Read(
+    Side to, size_t max_bytes,
+    grpc_event_engine::experimental::SliceBuffer& out) {
+  const Side from = OtherSide(to);
+  const size_t ring = SideIndex(from);
+  const uint64_t read_pos = read_pos_[ring];
+  const uint64_t write_pos = header_->ring[ring].write_pos.value.load();
+  if (write_pos < peer_write_pos_[ring] || write_pos - read_pos > ring_size_) {
+    return Corrupted("write position");
+  }
+  peer_write_pos_[ring] = write_pos;
+  const size_t n = std::min<size_t>(max_bytes, write_pos - read_pos);
+  if (n == 0) return 0;
+  const uint8_t* base = RingData(from);
+  const size_t offset = read_pos & (ring_size_ - 1);
+  const size_t first = std::min<size_t>(n, ring_size_ - offset);
+  MutableSlice slice = MutableSlice::CreateUninitialized(n);
+  memcpy(slice.data(), base + offset, first);
+  if (first < n) memcpy(slice.data() + first, base, n - first);
+  read_pos_[ring] = read_pos + n;
+  header_->ring[ring].read_pos.value.store(read_pos + n);
+  out.Append(Slice(std::move(slice)));
+  return n;
+}
+
+absl::Status SharedMemoryRegion::Corrupted(absl::string_view what) {
+  Close();
+  return absl::DataLossError(
+      absl::StrCat("Shared memory region ", name_, ": peer ring ", what,
+                   " out of range"));
+}
+
+void SharedMemoryRegion::Close() { header_->closed.store(1); }
+
+bool SharedMemoryRegion::closed() const { return header_->closed.load() != 0; }
+
+void SharedMemoryRegion::SetWaiting(Side side) {
+  header_->waiting[SideIndex(side)].value.store(1);
+}
+
+bool SharedMemoryRegion::TakeWaiting(Side side) {
+  return header_->waiting[SideIndex(side)].value.exchange(0) != 0;
+}
+
+void SharedMemoryRegion::TestOnlySetRingPositions(Side from,
+                                                  uint64_t write_pos,
+                                                  uint64_t read_pos) {
+  auto& ring = header_->ring[SideIndex(from)];
+  ring.write_pos.value.store(write_pos);
+  ring.read_pos.value.store(read_pos);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SharedMemoryEndpoint
+
+namespace {
+
+// Upper bound on the bytes returned by one Read call, so a large backlog in
+// the ring is handed up in digestible pieces.
+constexpr size_t kMaxReadBytes = 1024 * 1024;
+constexpr auto kDoorbellConnectTimeout = std::chrono::seconds(10);
+
+// State shared by a shared memory endpoint and the callbacks of its doorbell
+// connection, which can run after the endpoint has been destroyed.
+class SharedMemoryEndpointState final
+    : public RefCounted<SharedMemoryEndpointState> {
+ public:
+  SharedMemoryEndpointState(RefCountedPtr<SharedMemoryRegion> region,
+                            SharedMemoryRegion::Side side,
+                            std::unique_ptr<EventEngine::Endpoint> doorbell,
+                            std::shared_ptr<EventEngine> event_engine)
+      : region_(std::move(region)),
+        side_(side),
+        peer_(OtherSide(side)),
+        event_engine_(std::move(event_engine)),
+        doorbell_(std::move(doorbell)) {}
+
+  void Start() {
+    MutexLock lock(&mu_);
+    ListenForDoorbell();
+  }
+
+  void Shutdown() {
+    std::unique_ptr<EventEngine::Endpoint> doorbell;
+    {
+      MutexLock lock(&mu_);
+      region_->Close();
+      const absl::Status status = absl::CancelledError("Endpoint shutdown");
+      if (pending_read_.has_value()) {
+        RunCallback(std::move(pending_read_->callback), status);
+        pending_read_.reset();
+      }
+      if (pending_write_.has_value()) {
+        RunCallback(std::move(pending_write_->callback), status);
+        pending_write_.reset();
+      }
+      doorbell = std::move(doorbell_);
+    }
+    // Closing the doorbell cancels our read on it, and tells the peer we have
+    // gone.
+    doorbell.reset();
+  }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            grpc_event_engine::experimental::SliceBuffer* buffer) {
+    MutexLock lock(&mu_);
+    CHECK(!pending_read_.has_value());
+    auto result = ReadOrWait(buffer);
+    if (result.has_value()) {
+      if (result->ok()) return true;
+      RunCallback(std::move(on_read), std::move(*result));
+      return false;
+    }
+    pending_read_.emplace(PendingOp{std::move(on_read), buffer});
+    return false;
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             grpc_event_engine::experimental::SliceBuffer* data) {
+    MutexLock lock(&mu_);
+    CHECK(!pending_write_.has_value());
+    auto result = WriteOrWait(data);
+    if (result.has_value()) {
+      if (result->ok()) return true;
+      RunCallback(std::move(on_writable), std::move(*result));
+      return false;
+    }
+    pending_write_.emplace(PendingOp{std::move(on_writable), data});
+    return false;
+  }
+
+ private:
+  struct PendingOp {
+    absl::AnyInvocable<void(absl::Status)> callback;
+    grpc_event_engine::experimental::SliceBuffer* buffer;
+  };
+
+  // Returns nullopt if the operation cannot make progress yet.
+  std::optional<absl::Status> TryRead(
+      grpc_event_engine::experimental::SliceBuffer* buffer)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    auto n = region_->Read(side_, kMaxReadBytes, *buffer);
+    if (!n.ok()) {
+      Ring();
+      return n.status();
+    }
+    if (*n != 0) {
+      WakePeer();
+      return absl::OkStatus();
+    }
+    if (region_->closed()) {
+      return absl::UnavailableError("Shared memory endpoint closed");
+    }
+    return std::nullopt;
+  }
+
+  std::optional<absl::Status> TryWrite(
+      grpc_event_engine::experimental::SliceBuffer* data)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (region_->closed()) {
+      return absl::UnavailableError("Shared memory endpoint closed");
+    }
+    if (data->Length() != 0) {
+      auto n = region_->Write(side_, *data);
+      if (!n.ok()) {
+        Ring();
+        return n.status();
+      }
+      if (*n != 0) WakePeer();
+    }
+    if (data->Length() == 0) return absl::OkStatus();
+    return std::nullopt;
+  }
+
+  // As TryRead/TryWrite, but if no progress can be made, arrange for the peer
+  // to ring the doorbell when it can.
+  std::optional<absl::Status> ReadOrWait(
+      grpc_event_engine::experimental::SliceBuffer* buffer)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    auto result = TryRead(buffer);
+    if (result.has_value()) return result;
+    region_->SetWaiting(side_);
+    return TryRead(buffer);
+  }
+
+  std::optional<absl::Status> WriteOrWait(
+      grpc_event_engine::experimental::SliceBuffer* data)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    auto result = TryWrite(data);
+    if (result.has_value()) return result;
+    region_->SetWaiting(side_);
+    return TryWrite(data);
+  }
+
+  // Retry pending operations after the doorbell rang.
+  void Service() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (pending_read_.has_value()) {
+      auto result = ReadOrWait(pending_read_->buffer);
+      if (result.has_value()) {
+        RunCallback(std::move(pending_read_->callback), std::move(*result));
+        pending_read_.reset();
+      }
+    }
+    if (pending_write_.has_value()) {
+      auto result = WriteOrWait(pending_write_->buffer);
+      if (result.has_value()) {
+        RunCallback(std::move(pending_write_->callback), std::move(*result));
+        pending_write_.reset();
+      }
+    }
+  }
+
+  void ListenForDoorbell() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    while (doorbell_ != nullptr) {
+      doorbell_in_.Clear();
+      if (!doorbell_->Read(
+              [self = Ref()](absl::Status status) {
+                self->OnDoorbell(std::move(status));
+              },
+              &doorbell_in_, nullptr)) {
+        return;
+      }
+      Service();
+    }
+  }
+
+  void OnDoorbell(absl::Status status) {
+    MutexLock lock(&mu_);
+    if (!status.ok()) {
+      // The peer has gone (or we are shutting down): nothing more will be
+      // written to the ring, so fail whatever cannot complete from it.
+      region_->Close();
+      Service();
+      return;
+    }
+    Service();
+    ListenForDoorbell();
+  }
+
+  void WakePeer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (region_->TakeWaiting(peer_)) Ring();
+  }
+
+  // Send a byte on the doorbell; rings requested while one is in flight are
+  // folded into one more.
+  void Ring() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (ringing_) {
+      ring_again_ = true;
+      return;
+    }
+    while (doorbell_ != nullptr) {
+      ringing_ = true;
+      doorbell_out_.Clear();
+      doorbell_out_.Append(Slice::FromCopiedString("\x01"));
+      if (!doorbell_->Write(
+              [self = Ref()](absl::Status status) {
+                self->OnRung(std::move(status));
+              },
+              &doorbell_out_, nullptr)) {
+        return;
+      }
+      ringing_ = false;
+      if (!std::exchange(ring_again_, false)) return;
+    }
+  }
+
+  void OnRung(absl::Status status) {
+    MutexLock lock(&mu_);
+    ringing_ = false;
+    // A failed ring means the peer has gone, which our doorbell read reports.
+    if (status.ok() && std::exchange(ring_again_, false)) Ring();
+  }
+
+  void RunCallback(absl::AnyInvocable<void(absl::Status)> callback,
+                   absl::Status status) {
+    event_engine_->Run(
+        [callback = std::move(callback), status = std::move(status)]() mutable {
+          callback(std::move(status));
+        });
+  }
+
+  const RefCountedPtr<SharedMemoryRegion> region_;
+  const SharedMemoryRegion::Side side_;
+  const SharedMemoryRegion::Side peer_;
+  const std::shared_ptr<EventEngine> event_engine_;
+  Mutex mu_;
+  std::unique_ptr<EventEngine::Endpoint> doorbell_ ABSL_GUARDED_BY(mu_);
+  grpc_event_engine::experimental::SliceBuffer doorbell_in_
+      ABSL_GUARDED_BY(mu_);
+  grpc_event_engine::experimental::SliceBuffer doorbell_out_
+      ABSL_GUARDED_BY(mu_);
+  bool ringing_ ABSL_GUARDED_BY(mu_) = false;
+  bool ring_again_ ABSL_GUARDED_BY(mu_) = false;
+  std::optional<PendingOp> pending_read_ ABSL_GUARDED_BY(mu_);
+  std::optional<PendingOp> pending_write_ ABSL_GUARDED_BY(mu_);
+};
+
+class SharedMemoryEndpoint final : public EventEngine::Endpoint {
+ public:
+  SharedMemoryEndpoint(RefCountedPtr<SharedMemoryRegion> region,
+                       SharedMemoryRegion::Side side,
+                       std::unique_ptr<EventEngine::Endpoint> doorbell,
+                       std::shared_ptr<EventEngine> event_engine)
+      : state_(MakeRefCounted<SharedMemoryEndpointState>(
+            std::move(region), side, std::move(doorbell),
+            std::move(event_engine))) {
+    state_->Start();
+  }
+
+  ~SharedMemoryEndpoint() override { state_->Shutdown(); }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            grpc_event_engine::experimental::SliceBuffer* buffer,
+            const ReadArgs*) override {
+    return state_->Read(std::move(on_read), buffer);
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             grpc_event_engine::experimental::SliceBuffer* data,
+             const WriteArgs*) override {
+    return state_->Write(std::move(on_writable), data);
+  }
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return address_;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return address_;
+  }
+
+ private:
+  const RefCountedPtr<SharedMemoryEndpointState> state_;
+  const EventEngine::ResolvedAddress address_;
+};
+
+using SharedMemoryConnectionLatch =
+    InterActivityLatch<absl::StatusOr<PromiseEndpoint>>;
+
+// The doorbell listens on an abstract unix socket named after the region, so
+// that only processes that were told the region's name can find it.
+absl::StatusOr<EventEngine::ResolvedAddress> DoorbellAddress(
+    absl::string_view region_name) {
+#ifdef GPR_LINUX
+  return grpc_event_engine::experimental::URIToResolvedAddress(
+      absl::StrCat("unix-abstract:", region_name.substr(1)));
+#else
+  return absl::UnimplementedError(
+      "Shared memory data endpoints are only supported on Linux");
+#endif
+}
+
+// Server side of the doorbell handshake: the first doorbell connection
+// accepted after the client has attached to the region completes it.
+class SharedMemoryOffer {
+ public:
+  SharedMemoryOffer(RefCountedPtr<SharedMemoryRegion> region,
+                    std::shared_ptr<EventEngine> event_engine)
+      : region_(std::move(region)), event_engine_(std::move(event_engine)) {}
+
+  void Accept(std::unique_ptr<EventEngine::Endpoint> doorbell) {
+    // Whoever connects before the region is attached is not our peer.
+    if (!region_->peer_attached()) return;
+    if (!MarkDone()) return;
+    region_->Unlink();
+    latch_.Set(PromiseEndpoint(
+        MakeSharedMemoryEndpoint(region_, SharedMemoryRegion::Side::kServer,
+                                 std::move(doorbell), event_engine_),
+        SliceBuffer()));
+  }
+
+  void Fail(absl::Status status) {
+    if (!MarkDone()) return;
+    latch_.Set(std::move(status));
+  }
+
+  void SetTimer(EventEngine::TaskHandle timer) {
+    MutexLock lock(&mu_);
+    if (done_) {
+      event_engine_->Cancel(timer);
+    } else {
+      timer_ = timer;
+    }
+  }
+
+  auto Wait() { return latch_.Wait(); }
+
+ private:
+  bool MarkDone() {
+    MutexLock lock(&mu_);
+    if (std::exchange(done_, true)) return false;
+    if (timer_.has_value()) event_engine_->Cancel(*timer_);
+    return true;
+  }
+
+  const RefCountedPtr<SharedMemoryRegion> region_;
+  const std::shared_ptr<EventEngine> event_engine_;
+  Mutex mu_;
+  bool done_ ABSL_GUARDED_BY(mu_) = false;
+  std::optional<EventEngine::TaskHandle> timer_ ABSL_GUARDED_BY(mu_);
+  SharedMemoryConnectionLatch latch_;
+};
+
+void ConnectSharedMemory(absl::string_view name,
+                         std::shared_ptr<EventEngine> event_engine,
+                         const MemoryQuotaRefPtr& memory_quota,
+                         std::shared_ptr<SharedMemoryConnectionLatch> latch) {
+  auto region = SharedMemoryRegion::Attach(name);
+  if (!region.ok()) {
+    latch->Set(region.status());
+    return;
+  }
+  auto address = DoorbellAddress(name);
+  if (!address.ok()) {
+    latch->Set(address.status());
+    return;
+  }
+  event_engine->Connect(
+      [region = std::move(*region), event_engine,
+       latch](absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+                  doorbell) mutable {
+        if (!doorbell.ok()) {
+          latch->Set(doorbell.status());
+          return;
+        }
+        latch->Set(PromiseEndpoint(
+            MakeSharedMemoryEndpoint(std::move(region),
+                                     SharedMemoryRegion::Side::kClient,
+                                     std::move(*doorbell),
+                                     std::move(event_engine)),
+            SliceBuffer()));
+      },
+      *address,
+      grpc_event_engine::experimental::ChannelArgsEndpointConfig(
+          ChannelArgs()),
+      memory_quota->CreateMemoryAllocator("chaotic_good_shared_memory_doorbell"),
+      kDoorbellConnectTimeout);
+}
+
+#ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
+// Returns the raw IP address bytes of `addr`, with v4-mapped v6 addresses
+// normalized to v4.
+std::optional<std::string> HostAddressBytes(
+    const EventEngine::ResolvedAddress& addr) {
+  EventEngine::ResolvedAddress addr4;
+  const EventEngine::ResolvedAddress* a = &addr;
+  if (grpc_event_engine::experimental::ResolvedAddressIsV4Mapped(addr,
+                                                                 &addr4)) {
+    a = &addr4;
+  }
+  switch (a->address()->sa_family) {
+    case AF_INET: {
+      const auto* in = reinterpret_cast<const sockaddr_in*>(a->address());
+      return std::string(reinterpret_cast<const char*>(&in->sin_addr),
+                         sizeof(in->sin_addr));
+    }
+    case AF_INET6: {
+      const auto* in6 = reinterpret_cast<const sockaddr_in6*>(a->address());
+      return std::string(reinterpret_cast<const char*>(&in6->sin6_addr),
+                         sizeof(in6->sin6_addr));
+    }
+  }
+  return std::nullopt;
+}
+#endif
+
+}  // namespace
+
+std::unique_ptr<EventEngine::Endpoint> MakeSharedMemoryEndpoint(
+    RefCountedPtr<SharedMemoryRegion> region, SharedMemoryRegion::Side side,
+    std::unique_ptr<EventEngine::Endpoint> doorbell,
+    std::shared_ptr<EventEngine> event_engine) {
+  return std::make_unique<SharedMemoryEndpoint>(
+      std::move(region), side, std::move(doorbell), std::move(event_engine));
+}
+
+bool PeerIsOnSameHost(const PromiseEndpoint& endpoint) {
+#ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
+  const auto& peer = endpoint.GetPeerAddress();
+  if (peer.size() == 0) return false;
+#ifdef GRPC_HAVE_UNIX_SOCKET
+  if (peer.address()->sa_family == AF_UNIX) return true;
+#endif
+  auto peer_host = HostAddressBytes(peer);
+  auto local_host = HostAddressBytes(endpoint.GetLocalAddress());
+  return peer_host.has_value() && peer_host == local_host;
+#else
+  return false;
+#endif
+}
+
+absl::StatusOr<PendingConnection> OfferSharedMemoryConnection(
+    RefCountedPtr<SharedMemoryRegion> region, Duration timeout,
+    std::shared_ptr<EventEngine> event_engine, MemoryQuotaRefPtr memory_quota) {
+  auto address = DoorbellAddress(region->name());
+  if (!address.ok()) return address.status();
+  std::string name = region->name();
+  auto offer =
+      std::make_shared<SharedMemoryOffer>(std::move(region), event_engine);
+  auto listener = event_engine->CreateListener(
+      [offer](std::unique_ptr<EventEngine::Endpoint> doorbell,
+              MemoryAllocator) { offer->Accept(std::move(doorbell)); },
+      [](absl::Status) {},
+      grpc_event_engine::experimental::ChannelArgsEndpointConfig(
+          ChannelArgs()),
+      std::make_unique<MemoryQuotaBasedMemoryAllocatorFactory>(
+          std::move(memory_quota)));
+  if (!listener.ok()) return listener.status();
+  auto port = (*listener)->Bind(*address);
+  if (!port.ok()) return port.status();
+  auto status = (*listener)->Start();
+  if (!status.ok()) return status;
+  offer->SetTimer(event_engine->RunAfter(
+      timeout, [offer = std::weak_ptr<SharedMemoryOffer>(offer)]() {
+        if (auto o = offer.lock()) {
+          o->Fail(absl::DeadlineExceededError(
+              "Peer did not attach to shared memory region"));
+        }
+      }));
+  // The listener is dropped along with the promise: once it resolves, or if
+  // the connection is abandoned first.
+  return PendingConnection(
+      name, Map(offer->Wait(),
+                [offer, listener = std::move(*listener)](
+                    absl::StatusOr<PromiseEndpoint> endpoint) {
+                  return endpoint;
+                }));
+}
+
+PendingConnection AttachSharedMemoryConnection(absl::string_view name,
+                                               MemoryQuotaRefPtr memory_quota) {
+  auto latch = std::make_shared<SharedMemoryConnectionLatch>();
+  return PendingConnection(
+      name, Seq(
+                [name = std::string(name),
+                 memory_quota = std::move(memory_quota), latch]() {
+                  ConnectSharedMemory(
+                      name, GetContext<EventEngine>()->shared_from_this(),
+                      memory_quota, latch);
+                  return Empty{};
+                },
+                [latch](Empty) {
+                  return Map(latch->Wait(),
+                             [latch](absl::StatusOr<PromiseEndpoint> endpoint) {
+                               return endpoint;
+                             });
+                }));
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
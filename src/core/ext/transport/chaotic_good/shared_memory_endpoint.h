@@ -0,0 +1,173 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_ENDPOINT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_ENDPOINT_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+namespace shared_memory_detail {
+struct RegionHeader;
+}  // namespace shared_memory_detail
+
+// A pair of single-producer/single-consumer byte rings in a POSIX shared
+// memory object, used to carry chaotic_good data frames between two processes
+// on the same host without going through the kernel's TCP stack.
+//
+// The server creates the region and advertises its name in the settings frame;
+// the client attaches to it by name. Each side owns one ring for sending and
+// consumes the peer's ring for receiving. Each side keeps the ring positions it
+// owns in private memory, and checks the ones the peer publishes in the
+// mapping: a peer that reports an impossible position gets the region closed
+// rather than having us copy outside the ring.
+//
+// Not thread safe: each side must serialize its own calls.
+//
+// Only supported on Linux; elsewhere Create and Attach return UNIMPLEMENTED.
+class SharedMemoryRegion : public RefCounted<SharedMemoryRegion> {
+ public:
+  enum class Side : uint8_t { kServer = 0, kClient = 1 };
+
+  static absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> Create(
+      uint32_t ring_size);
+  static absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> Attach(
+      absl::string_view name);
+
+  ~SharedMemoryRegion() override;
+
+  SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+  SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+  const std::string& name() const { return name_; }
+  uint32_t ring_size() const { return ring_size_; }
+
+  // Server side: true once the client has attached to the region.
+  bool peer_attached() const;
+  // Remove the name of the region so no further processes can attach to it.
+  // The mapping itself stays valid until both sides have dropped it.
+  void Unlink();
+
+  // Copy as many bytes from the front of `data` as fit into the ring sent by
+  // `from`; returns the number of bytes copied.
+  absl::StatusOr<size_t> Write(
+      Side from, grpc_event_engine::experimental::SliceBuffer& data);
+  // Copy up to `max_bytes` bytes out of the ring received by `to` and append
+  // them to `out`; returns the number of bytes copied.
+  // Both fail with DATA_LOSS, and close the region, if the peer's position in
+  // the ring is out of range.
+  absl::StatusOr<size_t> Read(
+      Side to, size_t max_bytes,
+      grpc_event_engine::experimental::SliceBuffer& out);
+  // Bytes that `to` could currently read, and that `from` could currently
+  // write (0 if the peer's position is out of range).
+  size_t ReadableBytes(Side to) const;
+  size_t WritableBytes(Side from) const;
+
+  // Mark the region closed: further reads and writes by either side fail.
+  void Close();
+  bool closed() const;
+
+  // Wakeups are delivered out of band (see MakeSharedMemoryEndpoint); these
+  // let each side avoid sending one unless the other needs it.
+  // A side that cannot make progress calls SetWaiting and then checks the
+  // rings again; a side that has just moved a ring position calls TakeWaiting
+  // for its peer, and wakes it if that returns true. Either the waiter sees
+  // the new position or the mover sees the waiter.
+  void SetWaiting(Side side);
+  bool TakeWaiting(Side side);
+
+  // Overwrite the positions published for the ring sent by `from`, as a
+  // misbehaving peer could.
+  void TestOnlySetRingPositions(Side from, uint64_t write_pos,
+                                uint64_t read_pos);
+
+ private:
+  SharedMemoryRegion(std::string name, void* mapping, size_t mapping_size,
+                     uint32_t ring_size, bool owner);
+
+  uint8_t* RingData(Side side) const;
+  absl::Status Corrupted(absl::string_view what);
+
+  const std::string name_;
+  void* const mapping_;
+  const size_t mapping_size_;
+  const uint32_t ring_size_;
+  bool unlinked_;
+  shared_memory_detail::RegionHeader* const header_;
+  // Indexed by the side that writes into the ring.
+  // Positions we own: the authoritative copy, published to the mapping.
+  uint64_t write_pos_[2] = {0, 0};
+  uint64_t read_pos_[2] = {0, 0};
+  // The peer's positions as last validated; they must never go backwards.
+  uint64_t peer_write_pos_[2] = {0, 0};
+  uint64_t peer_read_pos_[2] = {0, 0};
+};
+
+// Same-host detection used by the server to decide whether to offer a shared
+// memory data endpoint: true for unix sockets and for TCP connections whose
+// peer address matches the local address (including loopback).
+bool PeerIsOnSameHost(const PromiseEndpoint& endpoint);
+
+// Wrap one side of a shared memory region as an EventEngine endpoint, so it can
+// be used anywhere a data endpoint is expected.
+// `doorbell` is a stream connection to the peer's endpoint that carries no
+// data: a byte is sent on it to wake the peer when it is waiting for the ring
+// to fill or drain, and it closing tells each side that the other has gone.
+// All waiting is done by reads on it, so no thread is dedicated to the
+// endpoint.
+std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+MakeSharedMemoryEndpoint(
+    RefCountedPtr<SharedMemoryRegion> region, SharedMemoryRegion::Side side,
+    std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+        doorbell,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine);
+
+// Server side: a pending connection that resolves once the client attaches to
+// `region` and connects the doorbell, or fails if that does not happen within
+// `timeout`. The doorbell is listened for on an abstract unix socket named
+// after the region, which is ready by the time this returns. The doorbell's
+// buffers are charged to `memory_quota`.
+absl::StatusOr<PendingConnection> OfferSharedMemoryConnection(
+    RefCountedPtr<SharedMemoryRegion> region, Duration timeout,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    MemoryQuotaRefPtr memory_quota);
+
+// Client side: a pending connection that attaches to the region named by the
+// server and connects the doorbell, charging its buffers to `memory_quota`.
+PendingConnection AttachSharedMemoryConnection(absl::string_view name,
+                                               MemoryQuotaRefPtr memory_quota);
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_ENDPOINT_H
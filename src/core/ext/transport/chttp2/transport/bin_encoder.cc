@@ -32,7 +32,7 @@ struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -91,79 +91,108 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+namespace {
+
+// Number of bytes that HuffmanWriter may store past the end of its output.
+constexpr size_t kHuffmanWriterSlack = 8;
+
+// Packs huffman codes, most significant bit first, into a 64-bit accumulator,
+// and stores all of its whole bytes at once with an 8-byte store. The bytes of
+// the store past the whole ones are overwritten by the next one, so the output
+// buffer needs kHuffmanWriterSlack bytes of room past the encoded data.
+class HuffmanWriter {
+ public:
+  explicit HuffmanWriter(uint8_t* out) : out_(out) {}
+
+  // Appends a code of length bits. The accumulator must have room for it: it
+  // never holds more than 7 bits after a Flush().
+  void Add(uint64_t bits, uint32_t length) {
+    acc_ = (acc_ << length) | bits;
+    acc_length_ += length;
   }
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+  uint32_t pending_bits() const { return acc_length_; }
+
+  // Stores the whole bytes of the accumulator.
+  void Flush() {
+    if (acc_length_ < 8) return;
+    const uint64_t aligned = acc_ << (64 - acc_length_);
+    for (int i = 0; i < 8; i++) {
+      out_[i] = static_cast<uint8_t>(aligned >> (56 - 8 * i));
     }
+    out_ += acc_length_ / 8;
+    acc_length_ %= 8;
   }
 
-  if (temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out++ =
-        static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
-                             static_cast<uint8_t>(0xffu >> temp_length));
+  // Stores the last partial byte, padded with the most significant bits of
+  // EOS (all ones), and returns the end of the output.
+  uint8_t* Finish() {
+    Flush();
+    if (acc_length_ != 0) {
+      *out_++ = static_cast<uint8_t>((acc_ << (8 - acc_length_)) |
+                                     (0xffu >> acc_length_));
+      acc_length_ = 0;
+    }
+    return out_;
   }
 
-  CHECK(out == GRPC_SLICE_END_PTR(output));
-
-  return output;
-}
-
-struct huff_out {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
+ private:
+  uint64_t acc_ = 0;
+  uint32_t acc_length_ = 0;
+  uint8_t* out_;
 };
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+
+// Huffman codes of all pairs of base64 symbols, indexed by the pair of
+// sextets (first << 6 | second): the code is in the upper 24 bits, and its
+// length (at most 22 bits) in the lower 8 bits.
+struct B64HuffPairTable {
+  constexpr B64HuffPairTable() : codes() {
+    for (int a = 0; a < 64; a++) {
+      for (int b = 0; b < 64; b++) {
+        const uint32_t length =
+            huff_alphabet[a].length + huff_alphabet[b].length;
+        const uint32_t bits =
+            (static_cast<uint32_t>(huff_alphabet[a].bits)
+             << huff_alphabet[b].length) |
+            huff_alphabet[b].bits;
+        codes[(a << 6) | b] = (bits << 8) | length;
+      }
+    }
   }
-}
+  uint32_t codes[64 * 64];
+};
+
+constexpr B64HuffPairTable kB64HuffPairs;
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
-  *wire_size += 2;
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+void AddB64Pair(HuffmanWriter* out, uint32_t pair) {
+  const uint32_t code = kB64HuffPairs.codes[pair];
+  out->Add(code >> 8, code & 0xff);
 }
 
-static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
-  *wire_size += 1;
-  b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+}  // namespace
+
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  size_t nbits = 0;
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    nbits += grpc_chttp2_huffsyms[*in].length;
+  }
+  const size_t output_length = nbits / 8 + (nbits % 8 != 0);
+
+  grpc_slice output = GRPC_SLICE_MALLOC(output_length + kHuffmanWriterSlack);
+  HuffmanWriter out(GRPC_SLICE_START_PTR(output));
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    // Codes are at most 30 bits long: flushing once more than 32 bits are
+    // pending leaves room for the next one.
+    if (out.pending_bits() > 32) out.Flush();
+    out.Add(grpc_chttp2_huffsyms[*in].bits, grpc_chttp2_huffsyms[*in].length);
+  }
+  uint8_t* end = out.Finish();
+
+  CHECK(end == GRPC_SLICE_START_PTR(output) + output_length);
+  GRPC_SLICE_SET_LENGTH(output, output_length);
+  return output;
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -174,26 +203,24 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   size_t output_syms = (input_triplets * 4) + tail_xtra[tail_case];
   size_t max_output_bits = 11 * output_syms;
   size_t max_output_length = (max_output_bits / 8) + (max_output_bits % 8 != 0);
-  grpc_slice output = GRPC_SLICE_MALLOC(max_output_length);
+  grpc_slice output =
+      GRPC_SLICE_MALLOC(max_output_length + kHuffmanWriterSlack);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
-  huff_out out;
+  HuffmanWriter out(start_out);
   size_t i;
 
-  out.temp = 0;
-  out.temp_length = 0;
-  out.out = start_out;
-  *wire_size = 0;
+  *wire_size = static_cast<uint32_t>(output_syms);
 
-  // encode full triplets
+  // encode full triplets: their four base64 symbols are encoded as two pairs,
+  // at most 44 bits, which fit in the accumulator along with the bits left
+  // from the previous triplet
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    AddB64Pair(&out, triplet >> 12);
+    AddB64Pair(&out, triplet & 0xfff);
+    out.Flush();
     in += 3;
   }
 
@@ -202,32 +229,22 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4),
-               wire_size);
+      AddB64Pair(&out, static_cast<uint32_t>(in[0]) << 4);
       in += 1;
       break;
     case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2), wire_size);
+      const uint32_t pair = (static_cast<uint32_t>(in[0]) << 4) | (in[1] >> 4);
+      AddB64Pair(&out, pair);
+      const b64_huff_sym sym = huff_alphabet[(in[1] & 0xf) << 2];
+      out.Add(sym.bits, sym.length);
       in += 2;
       break;
     }
   }
 
-  if (out.temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out.out++ = static_cast<uint8_t>(
-        static_cast<uint8_t>(out.temp << (8u - out.temp_length)) |
-        static_cast<uint8_t>(0xffu >> out.temp_length));
-  }
-
-  CHECK(out.out <= GRPC_SLICE_END_PTR(output));
-  GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
+  uint8_t* end = out.Finish();
+  CHECK(end <= start_out + max_output_length);
+  GRPC_SLICE_SET_LENGTH(output, end - start_out);
 
   CHECK(in == GRPC_SLICE_END_PTR(input));
   return output;
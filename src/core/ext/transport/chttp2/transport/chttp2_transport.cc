@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -74,6 +75,7 @@
 #include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/extensions/bdp_estimate.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -126,6 +128,40 @@
 #define GRPC_ARG_HTTP2_PING_ON_RST_STREAM_PERCENT \
   "grpc.http2.ping_on_rst_stream_percent"
 
+// Quantum, in bytes, of the deficit round robin scheduling of the DATA frames
+// of the streams of a transport. 0 (the default) disables the scheduling.
+#define GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES \
+  "grpc.experimental.http2_write_quantum_bytes"
+
+// If true, metadata without a known trait is indexed in the HPACK table once
+// it is seen repeating on the connection, instead of always being sent as
+// literals.
+#define GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING \
+  "grpc.experimental.http2_hpack_adaptive_indexing"
+
+// If true, header blocks are encoded once and sent again as they are for
+// identical metadata, as long as the HPACK table they refer to is unchanged.
+#define GRPC_ARG_HTTP2_HPACK_ENCODED_BLOCK_CACHE \
+  "grpc.experimental.http2_hpack_encoded_block_cache"
+
+// If true, values added to the HPACK decoder table are shared with other
+// connections that received the same values, rather than copied per
+// connection.
+#define GRPC_ARG_HTTP2_HPACK_SHARED_DECODER_ENTRIES \
+  "grpc.experimental.http2_hpack_shared_decoder_entries"
+
+// If true, receive completions for DATA frames are batched: all frames of a
+// read are parsed first, then each stream that received data completes its
+// pending receive once.
+#define GRPC_ARG_HTTP2_BATCH_READ_COMPLETIONS \
+  "grpc.experimental.http2_batch_read_completions"
+
+// Window, in microseconds, for which a write of call data initiated shortly
+// after the previous write waits for more data to coalesce with. 0 (the
+// default) disables write coalescing.
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_US \
+  "grpc.experimental.http2_write_coalescing_us"
+
 static grpc_core::Duration g_default_client_keepalive_time =
     grpc_core::Duration::Infinity();
 static grpc_core::Duration g_default_client_keepalive_timeout =
@@ -152,6 +188,9 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                              grpc_error_handle error);
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void write_coalescing_timer_expired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void flush_coalesced_write_locked(grpc_chttp2_transport* t);
 
 static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                         grpc_error_handle error);
@@ -434,10 +473,30 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  if (channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_ADAPTIVE_INDEXING)
+          .value_or(false)) {
+    t->hpack_compressor.EnableAdaptiveIndexing();
+  }
+  if (channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_ENCODED_BLOCK_CACHE)
+          .value_or(false)) {
+    t->hpack_compressor.EnableEncodedBlockCache();
+  }
+  t->batch_read_completions =
+      channel_args.GetBool(GRPC_ARG_HTTP2_BATCH_READ_COMPLETIONS)
+          .value_or(false);
+  t->hpack_parser.hpack_table()->set_intern_entries(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_SHARED_DECODER_ENTRIES)
+          .value_or(false));
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
+  t->write_scheduler.SetQuantum(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_QUANTUM_BYTES).value_or(0)));
+  t->write_size_policy.SetCoalescingWindow(std::chrono::microseconds(
+      grpc_core::Clamp(channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_US)
+                           .value_or(0),
+                       0, 1000000)));
   t->keepalive_time =
       std::max(grpc_core::Duration::Milliseconds(1),
                channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
@@ -618,6 +677,7 @@ void grpc_chttp2_transport::WriteSecurityFrameLocked(
   grpc_chttp2_initiate_write(this, GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE);
 }
 
+using grpc_event_engine::experimental::EndpointBdpEstimateExtension;
 using grpc_event_engine::experimental::QueryExtension;
 using grpc_event_engine::experimental::TcpTraceExtension;
 
@@ -660,6 +720,15 @@ grpc_chttp2_transport::grpc_chttp2_transport(
     }
   }
 
+  if (flow_control.bdp_probe() &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          ep.get())) {
+    bdp_estimate_endpoint_extension = QueryExtension<
+        EndpointBdpEstimateExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            ep.get()));
+  }
+
   if (channel_args.GetBool(GRPC_ARG_SECURITY_FRAME_ALLOWED).value_or(false)) {
     transport_framing_endpoint_extension = QueryExtension<
         grpc_core::TransportFramingEndpointExtension>(
@@ -692,6 +761,7 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   settings.mutable_local().SetAllowTrueBinaryMetadata(true);
 
   read_channel_args(this, channel_args, is_client);
+  hpack_parser.hpack_table()->SetMemoryOwner(&memory_owner);
 
   next_adjusted_keepalive_timestamp = grpc_core::Timestamp::InfPast();
 
@@ -749,6 +819,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
   end_all_the_calls(t, error);
   cancel_pings(t, error);
   if (t->closed_with_error.ok()) {
+    // The close waits for the write in progress: do not hold it back.
+    if (t->write_coalescing_timer_handle != TaskHandle::kInvalid) {
+      flush_coalesced_write_locked(t);
+    }
     if (!grpc_error_has_clear_grpc_status(error)) {
       error =
           grpc_error_set_int(error, grpc_core::StatusIntProperty::kRpcStatus,
@@ -887,6 +961,7 @@ grpc_chttp2_stream::~grpc_chttp2_stream() {
   t->streams_allocated.fetch_sub(1, std::memory_order_relaxed);
   grpc_chttp2_list_remove_stalled_by_stream(t.get(), this);
   grpc_chttp2_list_remove_stalled_by_transport(t.get(), this);
+  grpc_chttp2_list_remove_received_data(t.get(), this);
 
   if (t->channelz_socket != nullptr) {
     if ((t->is_client && eos_received) || (!t->is_client && eos_sent)) {
@@ -996,12 +1071,73 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Whether a write initiated for this reason may wait for more data to be
+// coalesced with: only writes of call data that leave the stream open are
+// delayed, never those that close a stream or carry control frames such as
+// pings, settings or window updates.
+static bool write_can_be_coalesced(grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void flush_coalesced_write_locked(grpc_chttp2_transport* t) {
+  // If the timer already fired, write_coalescing_timer_expired_locked is
+  // about to begin the write.
+  if (t->event_engine->Cancel(t->write_coalescing_timer_handle)) {
+    t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+    t->combiner->FinallyRun(
+        grpc_core::InitTransportClosure<write_action_begin_locked>(
+            t->Ref(), &t->write_action_begin_locked),
+        absl::OkStatus());
+  }
+}
+
+static void write_coalescing_timer_expired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    grpc_error_handle /*error*/) {
+  t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+  write_action_begin_locked(std::move(t), absl::OkStatus());
+}
+
+// Returns true if the write that was just initiated was delayed to coalesce it
+// with the data queued in the meantime.
+static bool maybe_coalesce_write_locked(
+    grpc_chttp2_transport* t, grpc_chttp2_initiate_write_reason reason) {
+  if (!t->write_size_policy.coalescing_enabled() ||
+      !write_can_be_coalesced(reason) ||
+      t->write_size_policy.CoalescedEnough(t->write_coalescing_bytes)) {
+    return false;
+  }
+  const auto delay =
+      t->write_size_policy.CoalescingDelay(std::chrono::steady_clock::now());
+  if (delay == std::chrono::microseconds::zero()) return false;
+  t->write_coalescing_timer_handle =
+      t->event_engine->RunAfter(delay, [t = t->Ref()]() mutable {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+        grpc_core::ExecCtx exec_ctx;
+        grpc_chttp2_transport* tp = t.get();
+        tp->combiner->Run(
+            grpc_core::InitTransportClosure<
+                write_coalescing_timer_expired_locked>(
+                std::move(t), &tp->write_coalescing_timer_expired_locked),
+            absl::OkStatus());
+      });
+  return true;
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   switch (t->write_state) {
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      if (maybe_coalesce_write_locked(t, reason)) break;
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -1024,6 +1160,14 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
           absl::OkStatus());
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
+      // A delayed write gathers everything that is queued when it begins.
+      if (t->write_coalescing_timer_handle != TaskHandle::kInvalid) {
+        if (!write_can_be_coalesced(reason) ||
+            t->write_size_policy.CoalescedEnough(t->write_coalescing_bytes)) {
+          flush_coalesced_write_locked(t);
+        }
+        break;
+      }
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
       break;
@@ -1039,6 +1183,19 @@ void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
   }
 }
 
+void grpc_chttp2_note_stream_unstalled(grpc_chttp2_stream* s) {
+  if (s->stream_stall_start == grpc_core::Timestamp::InfPast()) return;
+  grpc_core::global_stats().IncrementHttp2StreamStallDurationMs(
+      (grpc_core::Timestamp::Now() - s->stream_stall_start).millis());
+  s->stream_stall_start = grpc_core::Timestamp::InfPast();
+}
+
+void grpc_chttp2_update_channelz_flow_control(grpc_chttp2_transport* t) {
+  if (t->channelz_socket == nullptr) return;
+  t->channelz_socket->RecordFlowControlWindows(
+      t->flow_control.remote_window(), t->flow_control.announced_window());
+}
+
 static const char* begin_writing_desc(bool partial) {
   if (partial) {
     return "begin partial write in background";
@@ -1052,6 +1209,7 @@ static void write_action_begin_locked(
     grpc_error_handle /*error_ignored*/) {
   GRPC_LATENT_SEE_INNER_SCOPE("write_action_begin_locked");
   CHECK(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  t->write_coalescing_bytes = 0;
   grpc_chttp2_begin_write_result r;
   if (!t->closed_with_error.ok()) {
     r.writing = false;
@@ -1130,6 +1288,9 @@ static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
   t->write_size_policy.EndWrite(error.ok());
+  if (t->write_size_policy.coalescing_enabled()) {
+    t->write_size_policy.NoteWriteEnded(std::chrono::steady_clock::now());
+  }
 
   bool closed = false;
   if (!error.ok()) {
@@ -1428,6 +1589,19 @@ static void send_initial_metadata_locked(
                  s->send_initial_metadata->get(grpc_core::GrpcTimeoutMetadata())
                      .value_or(grpc_core::Timestamp::InfFuture()));
   }
+  if (t->write_scheduler.enabled()) {
+    std::string weight_buffer;
+    s->write_scheduler_state.weight =
+        grpc_core::Chttp2WriteScheduler::ParseWeight(
+            s->send_initial_metadata
+                ->GetStringValue(
+                    grpc_core::Chttp2WriteScheduler::kWeightMetadataKey,
+                    &weight_buffer)
+                .value_or(""));
+  }
+  // The weight is a hint to this transport only: keep it off the wire.
+  s->send_initial_metadata->Remove(
+      grpc_core::Chttp2WriteScheduler::kWeightMetadataKey);
   if (contains_non_ok_status(s->send_initial_metadata)) {
     s->seen_error = true;
   }
@@ -1571,6 +1745,7 @@ static void send_message_locked(
       *list = cb;
     }
 
+    t->write_coalescing_bytes += len + GRPC_HEADER_SIZE_IN_BYTES;
     if (s->id != 0 && (!s->write_buffering || s->flow_controlled_buffer.length >
                                                   t->write_buffer_size)) {
       grpc_chttp2_mark_stream_writable(t, s);
@@ -2254,6 +2429,7 @@ static grpc_chttp2_transport::RemovedStreamHandle remove_stream(
   }
   grpc_chttp2_list_remove_stalled_by_stream(t, s);
   grpc_chttp2_list_remove_stalled_by_transport(t, s);
+  grpc_chttp2_list_remove_received_data(t, s);
 
   maybe_start_some_streams(t);
 
@@ -2758,6 +2934,15 @@ static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
                     error);
 }
 
+// Complete the receives of streams that were queued by DATA frames parsed in
+// batch_read_completions mode.
+static void complete_received_data_locked(grpc_chttp2_transport* t) {
+  grpc_chttp2_stream* s;
+  while (grpc_chttp2_list_pop_received_data(t, &s)) {
+    grpc_chttp2_maybe_complete_recv_message(t, s);
+  }
+}
+
 static void read_action_parse_loop_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
@@ -2776,6 +2961,7 @@ static void read_action_parse_loop_locked(
         grpc_slice_buffer_sub_first(
             &t->read_buffer, *partial_read_size,
             GRPC_SLICE_LENGTH(t->read_buffer.slices[0]));
+        complete_received_data_locked(t.get());
         t->combiner->ForceOffload();
         auto* tp = t.get();
         tp->combiner->Run(
@@ -2788,6 +2974,7 @@ static void read_action_parse_loop_locked(
         errors[1] = std::move(std::get<absl::Status>(r));
       }
     }
+    complete_received_data_locked(t.get());
     if (errors[1] != absl::OkStatus()) {
       errors[2] = try_http_parsing(t.get());
       error = GRPC_ERROR_CREATE_REFERENCING("Failed parsing HTTP/2", errors,
@@ -2798,6 +2985,7 @@ static void read_action_parse_loop_locked(
       if (t->initial_window_update > 0) {
         grpc_chttp2_stream* s;
         while (grpc_chttp2_list_pop_stalled_by_stream(t.get(), &s)) {
+          grpc_chttp2_note_stream_unstalled(s);
           grpc_chttp2_mark_stream_writable(t.get(), s);
           grpc_chttp2_initiate_write(
               t.get(),
@@ -2806,6 +2994,7 @@ static void read_action_parse_loop_locked(
       }
       t->initial_window_update = 0;
     }
+    grpc_chttp2_update_channelz_flow_control(t.get());
   }
 
   bool keep_reading = false;
@@ -2883,6 +3072,7 @@ void schedule_bdp_ping_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
   auto* tp = t.get();
   tp->flow_control.bdp_estimator()->SchedulePing();
+  grpc_core::global_stats().IncrementHttp2BdpPingsSent();
   send_ping_locked(tp,
                    grpc_core::InitTransportClosure<start_bdp_ping>(
                        tp->Ref(), &tp->start_bdp_ping_locked),
@@ -2942,6 +3132,14 @@ static void finish_bdp_ping_locked(
   t->bdp_ping_started = false;
   grpc_core::Timestamp next_ping =
       t->flow_control.bdp_estimator()->CompletePing();
+  grpc_core::global_stats().IncrementHttp2BdpEstimate(
+      static_cast<int>(std::min<int64_t>(
+          t->flow_control.bdp_estimator()->EstimateBdp(),
+          std::numeric_limits<int>::max())));
+  if (t->bdp_estimate_endpoint_extension != nullptr) {
+    t->bdp_estimate_endpoint_extension->SetBdpEstimate(
+        t->flow_control.bdp_estimator()->EstimateBdp());
+  }
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t.get(),
                                     nullptr);
   CHECK(t->next_bdp_ping_timer_handle == TaskHandle::kInvalid);
@@ -27,6 +27,7 @@
 #include "absl/strings/str_format.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/stream_lists.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
@@ -55,13 +56,15 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              uint32_t write_bytes, int is_eof,
                              grpc_core::CallTracerInterface* call_tracer,
                              grpc_slice_buffer* outbuf) {
-  grpc_slice hdr;
-  uint8_t* p;
   static const size_t header_size = 9;
 
-  hdr = GRPC_SLICE_MALLOC(header_size);
-  p = GRPC_SLICE_START_PTR(hdr);
   CHECK(write_bytes < (1 << 24));
+  // The header is written in place at the end of outbuf (sharing an inlined
+  // slice with the previous frame's trailing bytes when they fit), and the
+  // payload is moved by reference: outbuf ends up as small header slices
+  // interleaved with the original message slices, which map one to one onto
+  // the iovecs of the endpoint write without any payload copy.
+  uint8_t* p = grpc_slice_buffer_tiny_add(outbuf, header_size);
   *p++ = static_cast<uint8_t>(write_bytes >> 16);
   *p++ = static_cast<uint8_t>(write_bytes >> 8);
   *p++ = static_cast<uint8_t>(write_bytes);
@@ -71,7 +74,6 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   *p++ = static_cast<uint8_t>(id >> 16);
   *p++ = static_cast<uint8_t>(id >> 8);
   *p++ = static_cast<uint8_t>(id);
-  grpc_slice_buffer_add(outbuf, hdr);
 
   grpc_slice_buffer_move_first_no_ref(inbuf, write_bytes, outbuf);
 
@@ -144,7 +146,11 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
                                                 int is_last) {
   grpc_core::CSliceRef(slice);
   grpc_slice_buffer_add(&s->frame_storage, slice);
-  grpc_chttp2_maybe_complete_recv_message(t, s);
+  if (t->batch_read_completions) {
+    grpc_chttp2_list_add_received_data(t, s);
+  } else {
+    grpc_chttp2_maybe_complete_recv_message(t, s);
+  }
 
   if (is_last && s->received_last_frame) {
     grpc_chttp2_mark_stream_closed(
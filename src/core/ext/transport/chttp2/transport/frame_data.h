@@ -46,6 +46,8 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* parser,
                                                 const grpc_slice& slice,
                                                 int is_last);
 
+// Moves the first write_bytes bytes of inbuf to outbuf as a DATA frame.
+// Payload bytes are never copied: refcounted slices are split by reference.
 void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
                              uint32_t write_bytes, int is_eof,
                              grpc_core::CallTracerInterface* call_tracer,
@@ -115,6 +115,7 @@ grpc_error_handle grpc_chttp2_window_update_parser_parse(
         grpc_core::global_stats().IncrementHttp2StreamRemoteWindowUpdate(
             received_update);
         if (grpc_chttp2_list_remove_stalled_by_stream(t, s)) {
+          grpc_chttp2_note_stream_unstalled(s);
           grpc_chttp2_mark_stream_writable(t, s);
           grpc_chttp2_initiate_write(
               t, GRPC_CHTTP2_INITIATE_WRITE_FLOW_CONTROL_UNSTALLED_BY_UPDATE);
@@ -133,6 +134,11 @@ grpc_error_handle grpc_chttp2_window_update_parser_parse(
           received_update);
       upd.RecvUpdate(received_update);
       if (upd.Finish() == grpc_core::chttp2::StallEdge::kUnstalled) {
+        if (t->transport_stall_start != grpc_core::Timestamp::InfPast()) {
+          grpc_core::global_stats().IncrementHttp2TransportStallDurationMs(
+              (now - t->transport_stall_start).millis());
+          t->transport_stall_start = grpc_core::Timestamp::InfPast();
+        }
         grpc_chttp2_initiate_write(
             t, GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL_UNSTALLED);
       }
@@ -24,7 +24,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
@@ -121,6 +123,20 @@ void HPackCompressor::SetMaxTableSize(uint32_t max_table_size) {
   }
 }
 
+void HPackCompressor::EnableAdaptiveIndexing() {
+  if (unknown_metadata_index_ == nullptr) {
+    unknown_metadata_index_ =
+        std::make_unique<hpack_encoder_detail::UnknownMetadataIndex>();
+  }
+}
+
+void HPackCompressor::EnableEncodedBlockCache() {
+  if (encoded_block_cache_ == nullptr) {
+    encoded_block_cache_ =
+        std::make_unique<hpack_encoder_detail::EncodedBlockCache>();
+  }
+}
+
 namespace {
 struct WireValue {
   WireValue(uint8_t huffman_prefix, bool insert_null_before_wire_value,
@@ -307,6 +323,16 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output_.Append(emit.data());
 }
 
+void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(uint32_t key_index,
+                                                     Slice value_slice) {
+  NonBinaryStringValue emit(std::move(value_slice));
+  VarintWriter<4> key(key_index);
+  uint8_t* data = output_.AddTiny(key.length() + emit.prefix_length());
+  key.Write(0x00, data);
+  emit.WritePrefix(data + key.length());
+  output_.Append(emit.data());
+}
+
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
@@ -356,8 +382,106 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
   values_.emplace_back(value.Ref(), index);
 }
 
+bool UnknownMetadataIndex::IsSensitiveKey(absl::string_view key) {
+  return key == "authorization" || key == "proxy-authorization" ||
+         absl::StrContains(key, "cookie");
+}
+
+void UnknownMetadataIndex::EmitTo(const Slice& key, const Slice& value,
+                                  bool is_binary, Encoder* encoder) {
+  if (IsSensitiveKey(key.as_string_view())) {
+    if (is_binary) {
+      encoder->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    } else {
+      encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    }
+    return;
+  }
+  auto& table = encoder->hpack_table();
+  Pair& pair = pairs_[absl::HashOf(key.as_string_view(),
+                                   value.as_string_view()) %
+                      kNumSlots];
+  const bool repeated = pair.key == key && pair.value == value;
+  if (repeated && table.ConvertibleToDynamicIndex(pair.index)) {
+    encoder->EmitIndexed(table.DynamicIndex(pair.index));
+    return;
+  }
+  Key& key_entry = keys_[absl::HashOf(key.as_string_view()) % kNumSlots];
+  if (repeated) {
+    // Binary values are sent base64 encoded unless true binary is enabled:
+    // size the entry for the longer of the two.
+    const size_t value_size =
+        is_binary ? value.size() * 4 / 3 + 2 : value.size();
+    const size_t max_entry_size =
+        std::min<size_t>(HPackEncoderTable::MaxEntrySize(),
+                         table.max_size() / kMaxTableShare);
+    if (hpack_constants::SizeForEntry(key.size(), value_size) <=
+        max_entry_size) {
+      pair.index =
+          is_binary
+              ? encoder->EmitLitHdrWithBinaryStringKeyIncIdx(key.Ref(),
+                                                             value.Ref())
+              : encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(),
+                                                                value.Ref());
+      if (pair.index != 0) {
+        key_entry.key = key.Ref();
+        key_entry.index = pair.index;
+      }
+      ++version_;
+      return;
+    }
+  } else {
+    pair.key = key.Ref();
+    pair.value = value.Ref();
+    pair.index = 0;
+    ++version_;
+  }
+  if (key_entry.key == key &&
+      table.ConvertibleToDynamicIndex(key_entry.index)) {
+    const uint32_t key_index = table.DynamicIndex(key_entry.index);
+    if (is_binary) {
+      encoder->EmitLitHdrWithBinaryStringKeyNotIdx(key_index, value.Ref());
+    } else {
+      encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key_index, value.Ref());
+    }
+  } else if (is_binary) {
+    encoder->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  } else {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  }
+}
+
+const SliceBuffer* EncodedBlockCache::Lookup(absl::string_view fingerprint,
+                                             bool use_true_binary_metadata,
+                                             uint64_t table_version) const {
+  for (const Entry& entry : entries_) {
+    if (entry.table_version == table_version &&
+        entry.use_true_binary_metadata == use_true_binary_metadata &&
+        entry.fingerprint == fingerprint) {
+      return &entry.block;
+    }
+  }
+  return nullptr;
+}
+
+void EncodedBlockCache::Insert(std::string fingerprint,
+                               bool use_true_binary_metadata,
+                               uint64_t table_version, SliceBuffer block) {
+  Entry& entry = entries_[next_entry_];
+  next_entry_ = (next_entry_ + 1) % kNumEntries;
+  entry.fingerprint = std::move(fingerprint);
+  entry.use_true_binary_metadata = use_true_binary_metadata;
+  entry.table_version = table_version;
+  entry.block = std::move(block);
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
-  if (absl::EndsWith(key.as_string_view(), "-bin")) {
+  const bool is_binary = absl::EndsWith(key.as_string_view(), "-bin");
+  if (compressor_->unknown_metadata_index_ != nullptr) {
+    compressor_->unknown_metadata_index_->EmitTo(key, value, is_binary, this);
+    return;
+  }
+  if (is_binary) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   } else {
     EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
@@ -24,6 +24,10 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -71,6 +75,8 @@ class Encoder {
                                            Slice value_slice);
   void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                               Slice value_slice);
+  void EmitLitHdrWithNonBinaryStringKeyNotIdx(uint32_t key_index,
+                                              Slice value_slice);
 
   void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key, Slice value,
                            size_t transport_length);
@@ -265,6 +271,48 @@ class SliceIndex {
   std::vector<ValueIndex> values_;
 };
 
+// Adaptive indexing of the metadata that has no trait, which is otherwise
+// always emitted as literals without indexing.
+// Tracks which key/value pairs repeat on the connection, and indexes a pair
+// the second time it is sent if it takes at most 1/kMaxTableShare of the
+// peer's table, so that later occurrences are emitted as a table index. Pairs
+// that are not worth indexing still reuse the table index of their key if it
+// is in the table.
+// Credentials and cookies (see IsSensitiveKey) are never indexed, so that
+// their values never end up in the peer's table (RFC 7541 section 7.1).
+class UnknownMetadataIndex {
+ public:
+  void EmitTo(const Slice& key, const Slice& value, bool is_binary,
+              Encoder* encoder);
+
+  static bool IsSensitiveKey(absl::string_view key);
+
+  // Changes whenever EmitTo records a pair or key, i.e. whenever encoding the
+  // same metadata again could produce different bytes.
+  uint64_t version() const { return version_; }
+
+ private:
+  static constexpr size_t kNumSlots = 64;
+  static constexpr size_t kMaxTableShare = 4;
+
+  // Last key/value pair sent in this slot, and its table index if it was
+  // indexed.
+  struct Pair {
+    Slice key;
+    Slice value;
+    uint32_t index = 0;
+  };
+  // Last key of this slot that was indexed, and its table index.
+  struct Key {
+    Slice key;
+    uint32_t index = 0;
+  };
+
+  Pair pairs_[kNumSlots];
+  Key keys_[kNumSlots];
+  uint64_t version_ = 0;
+};
+
 template <typename MetadataTrait>
 class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
  public:
@@ -323,6 +371,76 @@ class Compressor<HttpSchemeMetadata, HttpSchemeCompressor> {
                   Encoder* encoder);
 };
 
+// Builds a string identifying the contents of a metadata batch, to look up
+// the encoded block cache of HPackCompressor.
+class FingerprintEncoder {
+ public:
+  // Batches with more metadata than this are not worth caching.
+  static constexpr size_t kMaxFingerprintSize = 1024;
+
+  void Encode(const Slice& key, const Slice& value) {
+    Append(key.as_string_view(), value.as_string_view());
+  }
+
+  template <typename MetadataTrait>
+  void Encode(MetadataTrait, const typename MetadataTrait::ValueType& value) {
+    // Timeouts are encoded relative to the current time.
+    if (std::is_same<typename MetadataTrait::CompressionTraits,
+                     TimeoutCompressor>::value) {
+      cacheable_ = false;
+      return;
+    }
+    if (!cacheable_) return;
+    Append(MetadataTrait::key(),
+           MetadataValueAsSlice<MetadataTrait>(value).as_string_view());
+  }
+
+  bool cacheable() const { return cacheable_; }
+  std::string TakeFingerprint() { return std::move(fingerprint_); }
+
+ private:
+  void Append(absl::string_view key, absl::string_view value) {
+    if (!cacheable_) return;
+    // Lengths make the fingerprint unambiguous.
+    absl::StrAppend(&fingerprint_, key.size(), ":", key, value.size(), ":",
+                    value);
+    if (fingerprint_.size() > kMaxFingerprintSize) cacheable_ = false;
+  }
+
+  std::string fingerprint_;
+  bool cacheable_ = true;
+};
+
+// Header blocks encoded by HPackCompressor that can be sent again as they are,
+// keyed by the fingerprint of their metadata.
+// A block is only cached if encoding it left the dynamic table unchanged, so
+// that it only refers to existing entries of the table. It stays valid for as
+// long as the table does not change.
+// Likewise, a block is not cached if encoding it changed what
+// UnknownMetadataIndex knows: replaying it would hide the repeats that the
+// index needs to see to decide what to index.
+class EncodedBlockCache {
+ public:
+  const SliceBuffer* Lookup(absl::string_view fingerprint,
+                            bool use_true_binary_metadata,
+                            uint64_t table_version) const;
+  void Insert(std::string fingerprint, bool use_true_binary_metadata,
+              uint64_t table_version, SliceBuffer block);
+
+ private:
+  static constexpr size_t kNumEntries = 4;
+
+  struct Entry {
+    std::string fingerprint;
+    bool use_true_binary_metadata = false;
+    uint64_t table_version = std::numeric_limits<uint64_t>::max();
+    SliceBuffer block;
+  };
+
+  Entry entries_[kNumEntries];
+  size_t next_entry_ = 0;
+};
+
 }  // namespace hpack_encoder_detail
 
 class HPackCompressor {
@@ -342,6 +460,12 @@ class HPackCompressor {
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Enables the adaptive indexing of metadata that has no trait (see
+  // hpack_encoder_detail::UnknownMetadataIndex).
+  void EnableAdaptiveIndexing();
+  // Enables the reuse of encoded header blocks for identical metadata (see
+  // hpack_encoder_detail::EncodedBlockCache).
+  void EnableEncodedBlockCache();
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
@@ -358,6 +482,15 @@ class HPackCompressor {
   template <typename HeaderSet>
   bool EncodeHeaders(const EncodeHeaderOptions& options,
                      const HeaderSet& headers, grpc_slice_buffer* output) {
+    // A pending table size update must be sent before any cached block.
+    if (encoded_block_cache_ != nullptr && !advertise_table_size_change_) {
+      hpack_encoder_detail::FingerprintEncoder fingerprint;
+      headers.Encode(&fingerprint);
+      if (fingerprint.cacheable()) {
+        return EncodeHeadersWithCache(options, headers,
+                                      fingerprint.TakeFingerprint(), output);
+      }
+    }
     SliceBuffer raw;
     hpack_encoder_detail::Encoder encoder(
         this, options.use_true_binary_metadata, raw);
@@ -381,6 +514,39 @@ class HPackCompressor {
   void Frame(const EncodeHeaderOptions& options, SliceBuffer& raw,
              grpc_slice_buffer* output);
 
+  template <typename HeaderSet>
+  bool EncodeHeadersWithCache(const EncodeHeaderOptions& options,
+                              const HeaderSet& headers, std::string fingerprint,
+                              grpc_slice_buffer* output) {
+    const uint64_t table_version = table_.version();
+    const SliceBuffer* cached = encoded_block_cache_->Lookup(
+        fingerprint, options.use_true_binary_metadata, table_version);
+    if (cached != nullptr) {
+      SliceBuffer raw = cached->Copy();
+      Frame(options, raw, output);
+      return true;
+    }
+    const uint64_t index_version = unknown_metadata_index_version();
+    SliceBuffer raw;
+    hpack_encoder_detail::Encoder encoder(
+        this, options.use_true_binary_metadata, raw);
+    headers.Encode(&encoder);
+    if (!encoder.saw_encoding_errors() && table_.version() == table_version &&
+        unknown_metadata_index_version() == index_version) {
+      encoded_block_cache_->Insert(std::move(fingerprint),
+                                   options.use_true_binary_metadata,
+                                   table_version, raw.Copy());
+    }
+    Frame(options, raw, output);
+    return !encoder.saw_encoding_errors();
+  }
+
+  uint64_t unknown_metadata_index_version() const {
+    return unknown_metadata_index_ == nullptr
+               ? 0
+               : unknown_metadata_index_->version();
+  }
+
   // maximum number of bytes we'll use for the decode table (to guard against
   // peers ooming us by setting decode table size high)
   uint32_t max_usable_size_ = hpack_constants::kInitialTableSize;
@@ -388,6 +554,12 @@ class HPackCompressor {
   // of this size
   bool advertise_table_size_change_ = false;
   HPackEncoderTable table_;
+  // Set if adaptive indexing is enabled.
+  std::unique_ptr<hpack_encoder_detail::UnknownMetadataIndex>
+      unknown_metadata_index_;
+  // Set if the encoded block cache is enabled.
+  std::unique_ptr<hpack_encoder_detail::EncodedBlockCache>
+      encoded_block_cache_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
@@ -24,6 +24,7 @@ namespace grpc_core {
 
 uint32_t HPackEncoderTable::AllocateIndex(size_t element_size) {
   DCHECK_GE(element_size, 32u);
+  ++version_;
 
   uint32_t new_index = tail_remote_index_ + table_elems_ + 1;
   DCHECK(element_size <= MaxEntrySize());
@@ -54,6 +55,7 @@ bool HPackEncoderTable::SetMaxSize(uint32_t max_table_size) {
   if (max_table_size == max_table_size_) {
     return false;
   }
+  ++version_;
   while (table_size_ > 0 && table_size_ > max_table_size) {
     EvictOne();
   }
@@ -50,6 +50,9 @@ class HPackEncoderTable {
   uint32_t test_only_table_size() const { return table_size_; }
   // Get the number of entries in the table
   uint32_t test_only_table_elems() const { return table_elems_; }
+  // Changes whenever entries are added to or evicted from the table, or its
+  // max size changes: dynamic indices are only stable while it does not.
+  uint64_t version() const { return version_; }
 
   // Convert an element index into a dynamic index
   uint32_t DynamicIndex(uint32_t index) const {
@@ -71,6 +74,7 @@ class HPackEncoderTable {
   uint32_t max_table_size_ = hpack_constants::kInitialTableSize;
   uint32_t table_elems_ = 0;
   uint32_t table_size_ = 0;
+  uint64_t version_ = 0;
   // The size of each element in the HPACK table.
   std::vector<EntrySize> elem_size_;
 };
@@ -994,11 +994,20 @@ class HPackParser::Parser {
         }
       }
     }
-    auto value_slice = value.value.Take();
+    // Values kept in the table may be shared with other connections. Interned
+    // slices are exactly sized and immutable, so unlike other slices they
+    // need no uniquely owned copy to be kept past the request.
+    const bool intern_value =
+        state_.add_to_table && state_.hpack_table.intern_entries();
+    auto value_slice =
+        intern_value
+            ? HPackInternedSlices::Intern(value.value.string_view())
+            : value.value.Take();
     const auto transport_size =
         key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
     auto md = grpc_metadata_batch::Parse(
-        key_string, std::move(value_slice), state_.add_to_table, transport_size,
+        key_string, std::move(value_slice),
+        state_.add_to_table && !intern_value, transport_size,
         [key_string, this](absl::string_view message, const Slice&) {
           if (!state_.field_error.ok()) return;
           input_->SetErrorAndContinueParsing(
@@ -1019,9 +1028,12 @@ class HPackParser::Parser {
   }
 
   ValidateMetadataResult ValidateKey(absl::string_view key) {
-    if (key == HttpSchemeMetadata::key() || key == HttpMethodMetadata::key() ||
-        key == HttpAuthorityMetadata::key() || key == HttpPathMetadata::key() ||
-        key == HttpStatusMetadata::key()) {
+    // Only pseudo headers start with ':', so most keys skip straight to the
+    // character validation.
+    if (!key.empty() && key[0] == ':' &&
+        (key == HttpSchemeMetadata::key() || key == HttpMethodMetadata::key() ||
+         key == HttpAuthorityMetadata::key() ||
+         key == HttpPathMetadata::key() || key == HttpStatusMetadata::key())) {
       return ValidateMetadataResult::kOk;
     }
     return ValidateHeaderKeyIsLegal(key);
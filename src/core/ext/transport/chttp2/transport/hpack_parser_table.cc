@@ -18,6 +18,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 
+#include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
@@ -26,6 +27,9 @@
 #include <cstring>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -36,9 +40,55 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/stats.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
+namespace {
+class InternedSlicePool {
+ public:
+  Slice Intern(absl::string_view s) {
+    Shard& shard = shards_[absl::HashOf(s) % kNumShards];
+    MutexLock lock(&shard.mu);
+    auto it = shard.slices.find(s);
+    if (it != shard.slices.end()) return it->second.Ref();
+    if (shard.slices.size() >= kMaxEntriesPerShard) {
+      // Strings still used by some table stay alive through their refs: the
+      // pool merely stops sharing them.
+      shard.slices.clear();
+    }
+    // Never inlined, so the bytes (and the map key) don't move with the slice.
+    grpc_slice c_slice = grpc_slice_malloc_large(s.size());
+    memcpy(GRPC_SLICE_START_PTR(c_slice), s.data(), s.size());
+    Slice slice(c_slice);
+    Slice result = slice.Ref();
+    const absl::string_view key = slice.as_string_view();
+    shard.slices.emplace(key, std::move(slice));
+    return result;
+  }
+
+ private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kMaxEntriesPerShard =
+      HPackInternedSlices::kMaxEntries / kNumShards;
+
+  struct Shard {
+    Mutex mu;
+    absl::flat_hash_map<absl::string_view, Slice> slices ABSL_GUARDED_BY(mu);
+  };
+  Shard shards_[kNumShards];
+};
+}  // namespace
+
+Slice HPackInternedSlices::Intern(absl::string_view s) {
+  // Short strings are inlined into the slice, which is cheaper than sharing.
+  if (s.size() <= GRPC_SLICE_INLINED_SIZE || s.size() > kMaxLength) {
+    return Slice::FromCopiedBuffer(s);
+  }
+  static NoDestruct<InternedSlicePool> pool;
+  return pool->Intern(s);
+}
+
 void HPackTable::MementoRingBuffer::Put(Memento m) {
   CHECK_LT(num_entries_, max_entries_);
   if (entries_.size() < max_entries_) {
@@ -117,6 +167,54 @@ HPackTable::MementoRingBuffer::~MementoRingBuffer() {
   });
 }
 
+HPackTable::~HPackTable() { ReleaseMemoryReservation(); }
+
+HPackTable::HPackTable(HPackTable&& other) noexcept {
+  *this = std::move(other);
+}
+
+HPackTable& HPackTable::operator=(HPackTable&& other) noexcept {
+  if (this == &other) return *this;
+  ReleaseMemoryReservation();
+  mem_used_ = other.mem_used_;
+  max_bytes_ = other.max_bytes_;
+  current_table_bytes_ = other.current_table_bytes_;
+  entries_ = std::move(other.entries_);
+  static_mementos_ = other.static_mementos_;
+  memory_owner_ = std::exchange(other.memory_owner_, nullptr);
+  reserved_bytes_ = std::exchange(other.reserved_bytes_, 0);
+  intern_entries_ = other.intern_entries_;
+  return *this;
+}
+
+void HPackTable::SetMemoryOwner(MemoryOwner* memory_owner) {
+  ReleaseMemoryReservation();
+  memory_owner_ = memory_owner;
+  UpdateMemoryReservation();
+}
+
+void HPackTable::UpdateMemoryReservation() {
+  if (memory_owner_ == nullptr || !memory_owner_->is_valid()) return;
+  const size_t used =
+      mem_used_ + entries_.allocated_entries() * sizeof(Memento);
+  if (used > reserved_bytes_) {
+    memory_owner_->Reserve(used - reserved_bytes_);
+  } else if (used < reserved_bytes_) {
+    memory_owner_->Release(reserved_bytes_ - used);
+  }
+  reserved_bytes_ = used;
+}
+
+void HPackTable::ReleaseMemoryReservation() {
+  // The owner may have been reset (e.g. when the transport is destroyed),
+  // in which case it has already forgotten about our reservation.
+  if (reserved_bytes_ != 0 && memory_owner_ != nullptr &&
+      memory_owner_->is_valid()) {
+    memory_owner_->Release(reserved_bytes_);
+  }
+  reserved_bytes_ = 0;
+}
+
 // Evict one element from the table
 void HPackTable::EvictOne() {
   auto first_entry = entries_.PopOne();
@@ -133,6 +231,7 @@ void HPackTable::SetMaxBytes(uint32_t max_bytes) {
     EvictOne();
   }
   max_bytes_ = max_bytes;
+  UpdateMemoryReservation();
 }
 
 bool HPackTable::SetCurrentTableSize(uint32_t bytes) {
@@ -146,6 +245,7 @@ bool HPackTable::SetCurrentTableSize(uint32_t bytes) {
   uint32_t new_cap = std::max(hpack_constants::EntriesForBytes(bytes),
                               hpack_constants::kInitialTableEntries);
   entries_.Rebuild(new_cap);
+  UpdateMemoryReservation();
   return true;
 }
 
@@ -167,6 +267,7 @@ bool HPackTable::Add(Memento md) {
   // copy the finalized entry in
   mem_used_ += md.md.transport_size();
   entries_.Put(std::move(md));
+  UpdateMemoryReservation();
   return true;
 }
 
@@ -181,6 +282,7 @@ void HPackTable::AddLargerThanCurrentTableSize() {
   while (entries_.num_entries()) {
     EvictOne();
   }
+  UpdateMemoryReservation();
 }
 
 std::string HPackTable::TestOnlyDynamicTableAsString() const {
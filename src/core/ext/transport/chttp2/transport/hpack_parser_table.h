@@ -29,8 +29,11 @@
 #include <vector>
 
 #include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/parsed_metadata.h"
 #include "src/core/util/no_destruct.h"
@@ -38,16 +41,43 @@
 
 namespace grpc_core {
 
+// Process wide pool of immutable slices for the values that many connections
+// add to their decoder tables (authorities, user agents...). A table entry
+// whose value is an interned slice shares those bytes with every other
+// connection, instead of holding a private copy or pinning the read buffer it
+// was parsed from. Keys are not interned.
+class HPackInternedSlices {
+ public:
+  // Longer strings are rarely repeated across connections.
+  static constexpr size_t kMaxLength = 256;
+  // Bound on the number of strings held by the pool.
+  static constexpr size_t kMaxEntries = 4096;
+
+  // Return a slice with the contents of `s`, sharing its bytes with previous
+  // callers that interned the same string where possible.
+  static Slice Intern(absl::string_view s);
+};
+
 // HPACK header table
 class HPackTable {
  public:
   HPackTable() = default;
-  ~HPackTable() = default;
+  ~HPackTable();
 
   HPackTable(const HPackTable&) = delete;
   HPackTable& operator=(const HPackTable&) = delete;
-  HPackTable(HPackTable&&) = default;
-  HPackTable& operator=(HPackTable&&) = default;
+  HPackTable(HPackTable&& other) noexcept;
+  HPackTable& operator=(HPackTable&& other) noexcept;
+
+  // Charge the memory used by the table to `memory_owner`, which must outlive
+  // the table (but may be reset before it is destroyed).
+  void SetMemoryOwner(MemoryOwner* memory_owner);
+  // Build the values of new entries from HPackInternedSlices. Keys are not
+  // interned.
+  void set_intern_entries(bool intern_entries) {
+    intern_entries_ = intern_entries;
+  }
+  bool intern_entries() const { return intern_entries_; }
 
   void SetMaxBytes(uint32_t max_bytes);
   bool SetCurrentTableSize(uint32_t bytes);
@@ -90,6 +120,9 @@ class HPackTable {
   uint32_t max_bytes() const { return max_bytes_; }
   uint32_t current_table_bytes() const { return current_table_bytes_; }
 
+  // Bytes currently charged to the memory owner.
+  size_t test_only_reserved_bytes() const { return reserved_bytes_; }
+
   // Dynamic table entries, stringified
   std::string TestOnlyDynamicTableAsString() const;
 
@@ -129,6 +162,7 @@ class HPackTable {
 
     uint32_t max_entries() const { return max_entries_; }
     uint32_t num_entries() const { return num_entries_; }
+    size_t allocated_entries() const { return entries_.capacity(); }
 
    private:
     // The index of the first entry in the buffer. May be greater than
@@ -157,6 +191,12 @@ class HPackTable {
 
   void EvictOne();
 
+  // Bring the reservation against memory_owner_ in line with the memory held
+  // by the table: the hpack accounted size of its entries, plus the ring
+  // buffer itself.
+  void UpdateMemoryReservation();
+  void ReleaseMemoryReservation();
+
   static const StaticMementos* GetStaticMementos() {
     static const NoDestruct<StaticMementos> static_mementos;
     return static_mementos.get();
@@ -173,6 +213,9 @@ class HPackTable {
   MementoRingBuffer entries_;
   // Static mementos
   const StaticMementos* static_mementos_ = GetStaticMementos();
+  MemoryOwner* memory_owner_ = nullptr;
+  size_t reserved_bytes_ = 0;
+  bool intern_entries_ = false;
 };
 
 }  // namespace grpc_core
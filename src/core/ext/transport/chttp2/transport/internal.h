@@ -55,9 +55,11 @@
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
 #include "src/core/ext/transport/chttp2/transport/ping_rate_policy.h"
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/extensions/bdp_estimate.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -99,6 +101,10 @@ typedef enum {
   // stream from these lists when the stream is removed.
   GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT,
   GRPC_CHTTP2_LIST_STALLED_BY_STREAM,
+  /// streams that received data during the current read, whose receive
+  /// completions are deferred to the end of the read (see
+  /// batch_read_completions)
+  GRPC_CHTTP2_LIST_RECEIVED_DATA,
   /// streams that are waiting to start because there are too many concurrent
   /// streams on the connection
   GRPC_CHTTP2_LIST_WAITING_FOR_CONCURRENCY,
@@ -269,6 +275,9 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_core::TransportFramingEndpointExtension*
       transport_framing_endpoint_extension = nullptr;
+  // Set if the endpoint sizes its receive buffers after our BDP estimate.
+  grpc_event_engine::experimental::EndpointBdpEstimateExtension*
+      bdp_estimate_endpoint_extension = nullptr;
 
   grpc_core::MemoryOwner memory_owner;
   const grpc_core::MemoryAllocator::Reservation self_reservation;
@@ -463,6 +472,15 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
       next_bdp_ping_timer_handle =
           grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
 
+  // write coalescing (see Chttp2WriteSizePolicy::CoalescingDelay)
+  /// timer that begins a delayed write, while the write state is WRITING
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_coalescing_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  grpc_closure write_coalescing_timer_expired_locked;
+  /// message bytes queued since the last write began
+  size_t write_coalescing_bytes = 0;
+
   // keep-alive ping support
   /// Closure to initialize a keepalive ping
   grpc_closure init_keepalive_ping_locked;
@@ -514,8 +532,14 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// how many DATA bytes each writable stream may send when it is picked
+  grpc_core::Chttp2WriteScheduler write_scheduler;
 
   bool reading_paused_on_pending_induced_frames = false;
+  /// if true, DATA frames only queue their stream on the received data list,
+  /// and receive completions run once per stream at the end of each read
+  /// rather than once per frame
+  bool batch_read_completions = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
   /// the peer
   bool enable_preferred_rx_crypto_frame_advertisement = false;
@@ -560,6 +584,9 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   // The last time a transport window update was received.
   grpc_core::Timestamp last_window_update_time =
       grpc_core::Timestamp::InfPast();
+  // When sending was stalled by the transport flow control window, or InfPast
+  // if it is not stalled.
+  grpc_core::Timestamp transport_stall_start = grpc_core::Timestamp::InfPast();
 
   GPR_NO_UNIQUE_ADDRESS grpc_core::latent_see::Flow write_flow;
 };
@@ -663,6 +690,8 @@ struct grpc_chttp2_stream {
   grpc_chttp2_write_cb* on_write_finished_cbs = nullptr;
   grpc_chttp2_write_cb* finish_after_write = nullptr;
   size_t sending_bytes = 0;
+  /// scheduling state of the stream in t->write_scheduler
+  grpc_core::Chttp2WriteScheduler::StreamState write_scheduler_state;
 
   /// Byte counter for number of bytes written
   size_t byte_counter = 0;
@@ -700,6 +729,9 @@ struct grpc_chttp2_stream {
   // The last time a stream window update was received.
   grpc_core::Timestamp last_window_update_time =
       grpc_core::Timestamp::InfPast();
+  // When sending was stalled by the stream flow control window, or InfPast if
+  // it is not stalled.
+  grpc_core::Timestamp stream_stall_start = grpc_core::Timestamp::InfPast();
 };
 
 #define GRPC_ARG_PING_TIMEOUT_MS "grpc.http2.ping_timeout_ms"
@@ -840,6 +872,13 @@ void grpc_chttp2_reset_ping_clock(grpc_chttp2_transport* t);
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s);
 
+/// record how long s was stalled by its flow control window, now that it
+/// was removed from the stalled_by_stream list
+void grpc_chttp2_note_stream_unstalled(grpc_chttp2_stream* s);
+
+/// publish the connection flow control windows to channelz
+void grpc_chttp2_update_channelz_flow_control(grpc_chttp2_transport* t);
+
 void grpc_chttp2_cancel_stream(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                                grpc_error_handle due_to_error, bool tarpit);
 
@@ -38,6 +38,8 @@ static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
       return "stalled_by_transport";
     case GRPC_CHTTP2_LIST_STALLED_BY_STREAM:
       return "stalled_by_stream";
+    case GRPC_CHTTP2_LIST_RECEIVED_DATA:
+      return "received_data";
     case GRPC_CHTTP2_LIST_WAITING_FOR_CONCURRENCY:
       return "waiting_for_concurrency";
     case STREAM_LIST_COUNT:
@@ -251,3 +253,18 @@ bool grpc_chttp2_list_remove_stalled_by_stream(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
   return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
 }
+
+void grpc_chttp2_list_add_received_data(grpc_chttp2_transport* t,
+                                        grpc_chttp2_stream* s) {
+  stream_list_add(t, s, GRPC_CHTTP2_LIST_RECEIVED_DATA);
+}
+
+bool grpc_chttp2_list_pop_received_data(grpc_chttp2_transport* t,
+                                        grpc_chttp2_stream** s) {
+  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_RECEIVED_DATA);
+}
+
+void grpc_chttp2_list_remove_received_data(grpc_chttp2_transport* t,
+                                           grpc_chttp2_stream* s) {
+  stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_RECEIVED_DATA);
+}
@@ -62,4 +62,11 @@ bool grpc_chttp2_list_pop_stalled_by_stream(grpc_chttp2_transport* t,
 bool grpc_chttp2_list_remove_stalled_by_stream(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s);
 
+void grpc_chttp2_list_add_received_data(grpc_chttp2_transport* t,
+                                        grpc_chttp2_stream* s);
+bool grpc_chttp2_list_pop_received_data(grpc_chttp2_transport* t,
+                                        grpc_chttp2_stream** s);
+void grpc_chttp2_list_remove_received_data(grpc_chttp2_transport* t,
+                                           grpc_chttp2_stream* s);
+
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_STREAM_LISTS_H
@@ -0,0 +1,54 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "absl/log/check.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+uint32_t Chttp2WriteScheduler::BeginTurn(StreamState* stream) const {
+  if (!enabled()) return std::numeric_limits<uint32_t>::max();
+  DCHECK_GE(stream->deficit, 0);
+  stream->deficit += static_cast<int64_t>(quantum_) * stream->weight;
+  return static_cast<uint32_t>(std::min<int64_t>(
+      stream->deficit, std::numeric_limits<uint32_t>::max()));
+}
+
+void Chttp2WriteScheduler::EndTurn(StreamState* stream, uint32_t sent,
+                                   bool backlogged) const {
+  if (!enabled()) return;
+  if (!backlogged) {
+    stream->deficit = 0;
+    return;
+  }
+  DCHECK_LE(sent, stream->deficit);
+  stream->deficit -= sent;
+}
+
+uint32_t Chttp2WriteScheduler::ParseWeight(absl::string_view value) {
+  int64_t weight;
+  if (!absl::SimpleAtoi(value, &weight)) return kDefaultWeight;
+  return static_cast<uint32_t>(
+      std::clamp<int64_t>(weight, 1, static_cast<int64_t>(kMaxWeight)));
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,74 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SCHEDULER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SCHEDULER_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// Decides how many DATA bytes a writable stream may send each time the write
+// loop picks it, so that streams carrying bulk data do not starve the other
+// streams of the connection.
+//
+// This is deficit round robin: whenever a stream is picked, its deficit grows
+// by the quantum times its weight, and the DATA bytes it sends are taken out
+// of its deficit. A stream that still has data to send afterwards goes back to
+// the end of the writable list and keeps the rest of its deficit for its next
+// turn; any other stream loses it.
+//
+// A quantum of 0 (the default) disables the scheduler: every stream may then
+// send as much as flow control and the write size target allow.
+class Chttp2WriteScheduler {
+ public:
+  // Metadata key carrying the weight of a stream, read from the initial
+  // metadata sent on it. The transport removes it before the metadata is
+  // encoded, so it is never sent to the peer.
+  static constexpr absl::string_view kWeightMetadataKey = "grpc-write-weight";
+  static constexpr uint32_t kDefaultWeight = 1;
+  static constexpr uint32_t kMaxWeight = 100;
+
+  // Scheduling state of one stream.
+  struct StreamState {
+    uint32_t weight = kDefaultWeight;
+    int64_t deficit = 0;
+  };
+
+  void SetQuantum(uint32_t quantum) { quantum_ = quantum; }
+  uint32_t quantum() const { return quantum_; }
+  bool enabled() const { return quantum_ != 0; }
+
+  // Starts the turn of a stream that the write loop picked, returning how
+  // many DATA bytes it may send during it.
+  uint32_t BeginTurn(StreamState* stream) const;
+  // Ends the turn of a stream that sent `sent` DATA bytes during it.
+  // `backlogged` is whether the stream has more data queued, and was put back
+  // on the writable list.
+  void EndTurn(StreamState* stream, uint32_t sent, bool backlogged) const;
+
+  // Parses the value of kWeightMetadataKey. Returns kDefaultWeight if it is
+  // not a number, and clamps it to [1, kMaxWeight] otherwise.
+  static uint32_t ParseWeight(absl::string_view value);
+
+ private:
+  uint32_t quantum_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SCHEDULER_H
@@ -57,4 +57,12 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+std::chrono::microseconds Chttp2WriteSizePolicy::CoalescingDelay(
+    std::chrono::steady_clock::time_point now) const {
+  if (!coalescing_enabled() || now - last_write_end_ > coalescing_window_) {
+    return std::chrono::microseconds::zero();
+  }
+  return coalescing_window_;
+}
+
 }  // namespace grpc_core
@@ -19,6 +19,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <chrono>
+
 #include "src/core/util/time.h"
 
 namespace grpc_core {
@@ -47,6 +49,31 @@ class Chttp2WriteSizePolicy {
   // Notify the policy that a write of some size has ended.
   void EndWrite(bool success);
 
+  // Write coalescing, disabled unless a window is set: a write initiated
+  // within the window after the previous write ended waits for up to the
+  // window for more data to be queued, so that many small messages go out in
+  // a single endpoint write. The first write after the connection was idle
+  // for longer than the window is never delayed.
+  // Useful windows are well below a millisecond, so unlike the rest of the
+  // policy this is timed with steady_clock rather than Timestamp.
+  void SetCoalescingWindow(std::chrono::microseconds window) {
+    coalescing_window_ = window;
+  }
+  bool coalescing_enabled() const {
+    return coalescing_window_ > std::chrono::microseconds::zero();
+  }
+  // How long to delay a write initiated at now (zero to write immediately).
+  std::chrono::microseconds CoalescingDelay(
+      std::chrono::steady_clock::time_point now) const;
+  // Whether queued_bytes make a write large enough not to wait any longer.
+  bool CoalescedEnough(size_t queued_bytes) const {
+    return queued_bytes >= current_target_;
+  }
+  // Notify the policy that a write ended at now (only needed with coalescing).
+  void NoteWriteEnded(std::chrono::steady_clock::time_point now) {
+    last_write_end_ = now;
+  }
+
  private:
   size_t current_target_ = 128 * 1024;
   Timestamp experiment_start_time_ = Timestamp::InfFuture();
@@ -58,6 +85,8 @@ class Chttp2WriteSizePolicy {
   // In this way, we need two consecutive fast/slow operations to adjust,
   // denoising the signal significantly
   int8_t state_ = 0;
+  std::chrono::microseconds coalescing_window_{0};
+  std::chrono::steady_clock::time_point last_write_end_;
 };
 
 }  // namespace grpc_core
@@ -375,7 +375,9 @@ class DataSendContext {
       : write_context_(write_context),
         t_(t),
         s_(s),
-        sending_bytes_before_(s_->sending_bytes) {}
+        sending_bytes_before_(s_->sending_bytes),
+        turn_bytes_(
+            t_->write_scheduler.BeginTurn(&s_->write_scheduler_state)) {}
 
   uint32_t stream_remote_window() const {
     return static_cast<uint32_t>(std::max(
@@ -384,12 +386,17 @@ class DataSendContext {
             static_cast<int64_t>(t_->settings.peer().initial_window_size())));
   }
 
+  int64_t sent_bytes() const {
+    return static_cast<int64_t>(s_->sending_bytes - sending_bytes_before_);
+  }
+
   uint32_t max_outgoing() const {
     return grpc_core::Clamp<uint32_t>(
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
              t_->flow_control.remote_window(),
-             static_cast<int64_t>(write_context_->target_write_size())}),
+             static_cast<int64_t>(write_context_->target_write_size()),
+             static_cast<int64_t>(turn_bytes_) - sent_bytes()}),
         0, std::numeric_limits<uint32_t>::max());
   }
 
@@ -411,11 +418,16 @@ class DataSendContext {
 
   bool is_last_frame() const { return is_last_frame_; }
 
+  // Ends the turn of the stream in the write scheduler.
+  void EndTurn() {
+    t_->write_scheduler.EndTurn(&s_->write_scheduler_state,
+                                static_cast<uint32_t>(sent_bytes()),
+                                s_->flow_controlled_buffer.length > 0);
+  }
+
   void CallCallbacks() {
-    if (update_list(
-            t_, static_cast<int64_t>(s_->sending_bytes - sending_bytes_before_),
-            &s_->on_flow_controlled_cbs, &s_->flow_controlled_bytes_flowed,
-            absl::OkStatus())) {
+    if (update_list(t_, sent_bytes(), &s_->on_flow_controlled_cbs,
+                    &s_->flow_controlled_bytes_flowed, absl::OkStatus())) {
       write_context_->NoteScheduledResults();
     }
   }
@@ -427,6 +439,7 @@ class DataSendContext {
   grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext sfc_upd_{
       &s_->flow_control};
   const size_t sending_bytes_before_;
+  const uint32_t turn_bytes_;
   bool is_last_frame_ = false;
 };
 
@@ -530,13 +543,21 @@ class StreamWriteContext {
     if (!data_send_context.AnyOutgoing()) {
       if (t_->flow_control.remote_window() <= 0) {
         grpc_core::global_stats().IncrementHttp2TransportStalls();
+        if (t_->transport_stall_start == grpc_core::Timestamp::InfPast()) {
+          t_->transport_stall_start = grpc_core::Timestamp::Now();
+        }
         report_stall(t_, s_, "transport");
         grpc_chttp2_list_add_stalled_by_transport(t_, s_);
       } else if (data_send_context.stream_remote_window() <= 0) {
         grpc_core::global_stats().IncrementHttp2StreamStalls();
+        if (s_->stream_stall_start == grpc_core::Timestamp::InfPast()) {
+          s_->stream_stall_start = grpc_core::Timestamp::Now();
+        }
         report_stall(t_, s_, "stream");
         grpc_chttp2_list_add_stalled_by_stream(t_, s_);
       }
+      // The stream is no longer in the writable list: it loses its deficit.
+      t_->write_scheduler.EndTurn(&s_->write_scheduler_state, 0, false);
       return;  // early out: nothing to do
     }
 
@@ -548,6 +569,7 @@ class StreamWriteContext {
     if (data_send_context.is_last_frame()) {
       SentLastFrame();
     }
+    data_send_context.EndTurn();
     data_send_context.CallCallbacks();
     stream_became_writable_ = true;
     if (s_->flow_controlled_buffer.length > 0) {
@@ -740,6 +762,7 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
 
   if (t->channelz_socket != nullptr) {
     t->channelz_socket->RecordMessagesSent(t->num_messages_in_next_write);
+    grpc_chttp2_update_channelz_flow_control(t);
   }
   t->num_messages_in_next_write = 0;
 
@@ -0,0 +1,43 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_BDP_ESTIMATE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_BDP_ESTIMATE_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+/// An Endpoint extension class that lets a transport share its estimate of
+/// the bandwidth-delay product of the connection with the endpoint, so that
+/// the endpoint can size its receive buffers accordingly.
+class EndpointBdpEstimateExtension {
+ public:
+  virtual ~EndpointBdpEstimateExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.bdp_estimate";
+  }
+
+  /// Reports the latest bandwidth-delay product estimate of the connection,
+  /// in bytes. It may be called at any time, including while a Read is
+  /// outstanding, and takes effect from the next read onwards.
+  virtual void SetBdpEstimate(int64_t bdp_bytes) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_BDP_ESTIMATE_H
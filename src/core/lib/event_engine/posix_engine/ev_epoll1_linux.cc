@@ -19,7 +19,9 @@
 #include <grpc/support/sync.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/log/check.h"
@@ -27,6 +29,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/iomgr/port.h"
@@ -48,6 +51,8 @@
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
 #include "src/core/util/fork.h"
 #include "src/core/util/status_helper.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
 
@@ -61,8 +66,9 @@ class Epoll1EventHandle : public EventHandle {
       : fd_(fd),
         list_(this),
         poller_(poller),
-        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
-        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        read_closure_(
+            std::make_unique<LockfreeEvent>(&poller->read_scheduler_)),
+        write_closure_(std::make_unique<LockfreeEvent>(&poller->write_queue_)),
         error_closure_(
             std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
     read_closure_->InitEvent();
@@ -307,7 +313,16 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+    : scheduler_(scheduler),
+      write_queue_(scheduler,
+                   grpc_core::ConfigVars::Get().PollerWriteBatchSize()),
+      read_scheduler_(scheduler,
+                      std::chrono::microseconds(
+                          grpc_core::ConfigVars::Get().PollerInlineBudgetUs())),
+      was_kicked_(false),
+      closed_(false),
+      max_spin_us_(std::max(0, grpc_core::ConfigVars::Get().PollerSpinUs())),
+      spin_us_(max_spin_us_) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   CHECK(wakeup_fd_ != nullptr);
@@ -437,6 +452,44 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
   return r;
 }
 
+int Epoll1Poller::SpinEpollWait(EventEngine::Duration& timeout) {
+  const int64_t window_us = spin_us_.load(std::memory_order_relaxed);
+  if (window_us == 0 || timeout <= EventEngine::Duration::zero()) return 0;
+  const auto start = std::chrono::steady_clock::now();
+  const auto spin_deadline =
+      start + std::min<EventEngine::Duration>(
+                  timeout, std::chrono::microseconds(window_us));
+  auto now = start;
+  do {
+    int r = DoEpollWait(EventEngine::Duration::zero());
+    if (r > 0) {
+      grpc_core::global_stats().IncrementPollerSpinHits();
+      spin_us_.store(max_spin_us_, std::memory_order_relaxed);
+      return r;
+    }
+    now = std::chrono::steady_clock::now();
+  } while (now < spin_deadline);
+  grpc_core::global_stats().IncrementPollerSpinMisses();
+  spin_us_.store(window_us / 2, std::memory_order_relaxed);
+  timeout = std::max<EventEngine::Duration>(
+      timeout - std::chrono::duration_cast<EventEngine::Duration>(now - start),
+      EventEngine::Duration::zero());
+  return 0;
+}
+
+int Epoll1Poller::SleepEpollWait(EventEngine::Duration timeout) {
+  if (max_spin_us_ == 0) return DoEpollWait(timeout);
+  const auto start = std::chrono::steady_clock::now();
+  int r = DoEpollWait(timeout);
+  // Events that arrive this soon after going to sleep would have been found by
+  // spinning, so reopen a window that decayed while the poller was idle.
+  if (r > 0 && std::chrono::steady_clock::now() - start <
+                   std::chrono::microseconds(max_spin_us_)) {
+    spin_us_.store(max_spin_us_, std::memory_order_relaxed);
+  }
+  return r;
+}
+
 // Might be called multiple times
 void Epoll1EventHandle::ShutdownHandle(absl::Status why) {
   // A mutex is required here because, the SetShutdown method of the
@@ -481,7 +534,8 @@ Poller::WorkResult Epoll1Poller::Work(
   Events pending_events;
   bool was_kicked_ext = false;
   if (g_epoll_set_.cursor == g_epoll_set_.num_events) {
-    if (DoEpollWait(timeout) == 0) {
+    // Spin for a while before sleeping in epoll_wait, if that is enabled.
+    if (SpinEpollWait(timeout) == 0 && SleepEpollWait(timeout) == 0) {
       return Poller::WorkResult::kDeadlineExceeded;
     }
   }
@@ -500,9 +554,15 @@ Poller::WorkResult Epoll1Poller::Work(
   }
   // Run the provided callback.
   schedule_poll_again();
-  // Process all pending events inline.
-  for (auto& it : pending_events) {
-    it->ExecutePendingActions();
+  // Process all pending events inline. The write closures made ready here are
+  // flushed together once all events have been processed, and then the
+  // non-blocking read closures are run on this thread, within budget.
+  {
+    PollerInlineScheduler::Pass read_pass(&read_scheduler_);
+    PollerWriteQueue::Batch write_batch(&write_queue_);
+    for (auto& it : pending_events) {
+      it->ExecutePendingActions();
+    }
   }
   return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
 }
@@ -542,7 +602,9 @@ namespace grpc_event_engine::experimental {
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::Poller;
 
-Epoll1Poller::Epoll1Poller(Scheduler* /* engine */) {
+Epoll1Poller::Epoll1Poller(Scheduler* /* engine */)
+    : write_queue_(nullptr, 0),
+      read_scheduler_(nullptr, std::chrono::microseconds(0)), max_spin_us_(0) {
   grpc_core::Crash("unimplemented");
 }
 
@@ -564,6 +626,14 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration /*timeout*/) {
   grpc_core::Crash("unimplemented");
 }
 
+int Epoll1Poller::SpinEpollWait(EventEngine::Duration& /*timeout*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+int Epoll1Poller::SleepEpollWait(EventEngine::Duration /*timeout*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 Poller::WorkResult Epoll1Poller::Work(
     EventEngine::Duration /*timeout*/,
     absl::FunctionRef<void()> /*schedule_poll_again*/) {
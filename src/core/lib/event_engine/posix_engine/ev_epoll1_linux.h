@@ -17,6 +17,7 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
@@ -28,6 +29,8 @@
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/poller_inline_scheduler.h"
+#include "src/core/lib/event_engine/posix_engine/poller_write_queue.h"
 #include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/sync.h"
@@ -90,6 +93,16 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Busy poll the epoll set without blocking for up to the current spin window
+  // (and never past timeout). It returns the number of events found, like
+  // DoEpollWait(). If no event shows up, it returns 0 and subtracts the time
+  // spent spinning from timeout.
+  int SpinEpollWait(
+      grpc_event_engine::experimental::EventEngine::Duration& timeout);
+  // Blocks in DoEpollWait() for up to timeout. If events show up within
+  // max_spin_us_, it reopens the spin window.
+  int SleepEpollWait(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
   class HandlesList {
    public:
     explicit HandlesList(Epoll1EventHandle* handle) : handle(handle) {}
@@ -117,12 +130,26 @@ class Epoll1Poller : public PosixEventPoller {
 #endif
   grpc_core::Mutex mu_;
   Scheduler* scheduler_;
+  // Schedules the write closures of the handles, batching the ones that
+  // become ready during the same Work() pass.
+  PollerWriteQueue write_queue_;
+  // Schedules the read closures of the handles, running the non-blocking ones
+  // that become ready during a Work() pass on the polling thread.
+  PollerInlineScheduler read_scheduler_;
   // A singleton epoll set
   EpollSet g_epoll_set_;
   bool was_kicked_ ABSL_GUARDED_BY(mu_);
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // Upper bound of the spin window in microseconds, read from the
+  // GRPC_POLLER_SPIN_US config var. Spinning is disabled if it is 0.
+  const int64_t max_spin_us_;
+  // The current spin window. It is reset to max_spin_us_ whenever an event
+  // shows up within max_spin_us_ of starting to wait for it, and halved
+  // whenever spinning finds nothing, so an idle poller stops spinning
+  // altogether.
+  std::atomic<int64_t> spin_us_;
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
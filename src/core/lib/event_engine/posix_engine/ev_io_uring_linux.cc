@@ -0,0 +1,936 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/sync.h>
+#include <grpc/support/time.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_format.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+
+// This polling engine is only relevant on linux kernels supporting io_uring
+#ifdef GRPC_LINUX_IO_URING
+#include <endian.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <chrono>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/fork.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#define MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION 1
+// Size of the submission queue. Every fd needs a single submission to be
+// registered, so this only bounds how many requests can be queued between
+// two submissions.
+#define IO_URING_SQ_ENTRIES 256
+// Size of the completion queue. Completions beyond this are kept by the
+// kernel (IORING_FEAT_NODROP) and flushed on the next wait.
+#define IO_URING_CQ_ENTRIES 4096
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// user_data of the completions that carry no information for the poller
+// (e.g. the completion of a poll removal request).
+constexpr uint64_t kIgnoredUserData = 0;
+
+constexpr uint32_t kPollMask = POLLIN | POLLPRI | POLLOUT | POLLERR | POLLHUP;
+
+// io_uring_sqe.poll32_events is stored with its 16-bit halves swapped on big
+// endian machines.
+uint32_t PollEvents(uint32_t events) {
+#if __BYTE_ORDER == __BIG_ENDIAN
+  events = (events << 16) | (events >> 16);
+#endif
+  return events;
+}
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, const void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        user_data_(EncodeUserData(track_err)),
+        poller_(poller),
+        read_closure_(
+            std::make_unique<LockfreeEvent>(&poller->read_scheduler_)),
+        write_closure_(std::make_unique<LockfreeEvent>(&poller->write_queue_)),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    user_data_ = EncodeUserData(track_err);
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+    grpc_core::MutexLock lock(&poll_mu_);
+    poll_armed_ = false;
+    orphan_started_ = false;
+    orphan_done_ = false;
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these need to be
+    // atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+
+    return pending_read || pending_write || pending_error;
+  }
+  // Register the poll request for the wrapped fd.
+  void Arm() {
+    grpc_core::MutexLock lock(&poll_mu_);
+    poll_armed_ = poller_->ArmPoll(fd_, kPollMask, user_data_);
+    if (!poll_armed_) {
+      LOG(ERROR) << "io_uring: unable to register fd " << fd_;
+    }
+  }
+  // Called when the kernel reports that the poll request of this handle has
+  // terminated (a completion without IORING_CQE_F_MORE). The request is
+  // re-armed unless the handle is being orphaned or the kernel reported an
+  // error. Returns true if the handle should be returned to the free list.
+  bool OnPollTerminated(int32_t res) {
+    grpc_core::MutexLock lock(&poll_mu_);
+    poll_armed_ = false;
+    if (!orphan_started_ && res >= 0) {
+      poll_armed_ = poller_->ArmPoll(fd_, kPollMask, user_data_);
+    }
+    return orphan_done_ && !poll_armed_;
+  }
+  uint64_t UserData() const { return user_data_; }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    // These may execute in Parallel with ShutdownHandle. Thats not an issue
+    // because the lockfree event implementation should be able to handle it.
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  bool OrphanDone() {
+    grpc_core::MutexLock lock(&poll_mu_);
+    return orphan_done_;
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  // Use the least significant bit of the user_data to store track_err, in the
+  // same way the epoll1 poller does with epoll_event.data.ptr.
+  uint64_t EncodeUserData(bool track_err) {
+    return static_cast<uint64_t>(reinterpret_cast<intptr_t>(this)) |
+           (track_err ? 1 : 0);
+  }
+  void HandleShutdownInternal(absl::Status why);
+  // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+  // required.
+  grpc_core::Mutex mu_;
+  // Guards the state of the poll request registered for this handle. Unlike
+  // epoll, io_uring poll requests hold a reference to the polled file, so a
+  // handle can only be reused once the kernel reports that its request has
+  // terminated *and* OrphanHandle has completed.
+  grpc_core::Mutex poll_mu_;
+  bool poll_armed_ ABSL_GUARDED_BY(poll_mu_) = false;
+  bool orphan_started_ ABSL_GUARDED_BY(poll_mu_) = false;
+  bool orphan_done_ ABSL_GUARDED_BY(poll_mu_) = false;
+  int fd_;
+  uint64_t user_data_;
+  // See Epoll1EventHandle::SetPendingActions for explanation on why
+  // pending_<***>_ need to be atomic.
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+namespace {
+
+// Only used when GRPC_ENABLE_FORK_SUPPORT=1
+std::list<IoUringPoller*> fork_poller_list;
+
+gpr_mu fork_poller_list_mu;
+
+void ForkPollerListAddPoller(IoUringPoller* poller) {
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_lock(&fork_poller_list_mu);
+    fork_poller_list.push_back(poller);
+    gpr_mu_unlock(&fork_poller_list_mu);
+  }
+}
+
+void ForkPollerListRemovePoller(IoUringPoller* poller) {
+  if (grpc_core::Fork::Enabled()) {
+    gpr_mu_lock(&fork_poller_list_mu);
+    fork_poller_list.remove(poller);
+    gpr_mu_unlock(&fork_poller_list_mu);
+  }
+}
+
+bool InitIoUringPollerLinux();
+
+// Called by the child process's post-fork handler. The rings of an io_uring
+// instance are shared with the child after fork, so the child must not submit
+// to or reap from them: close every poller, which drops the child's mapping
+// of its ring without affecting the parent.
+void ResetEventManagerOnFork() {
+  gpr_mu_lock(&fork_poller_list_mu);
+  while (!fork_poller_list.empty()) {
+    IoUringPoller* poller = fork_poller_list.front();
+    fork_poller_list.pop_front();
+    poller->Close();
+  }
+  gpr_mu_unlock(&fork_poller_list_mu);
+  InitIoUringPollerLinux();
+}
+
+void UnmapRing(void* ptr, size_t size) {
+  if (ptr != nullptr && ptr != MAP_FAILED) {
+    munmap(ptr, size);
+  }
+}
+
+// Creates an io_uring instance and maps its rings. Returns false on failure,
+// in which case nothing is left open.
+bool SetupRing(IoUringQueues* ring) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+  params.cq_entries = IO_URING_CQ_ENTRIES;
+  int fd = IoUringSetup(IO_URING_SQ_ENTRIES, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  // Timed waits and reliable delivery of completions are required.
+  if ((params.features & IORING_FEAT_EXT_ARG) == 0 ||
+      (params.features & IORING_FEAT_NODROP) == 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring: kernel lacks IORING_FEAT_EXT_ARG/IORING_FEAT_NODROP";
+    close(fd);
+    return false;
+  }
+  ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single_mmap) {
+    ring->sq_size = ring->cq_size = std::max(ring->sq_size, ring->cq_size);
+  }
+  ring->sq_ptr = mmap(nullptr, ring->sq_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring->sq_ptr == MAP_FAILED) {
+    ring->sq_ptr = nullptr;
+    close(fd);
+    return false;
+  }
+  if (single_mmap) {
+    ring->cq_ptr = ring->sq_ptr;
+  } else {
+    ring->cq_ptr = mmap(nullptr, ring->cq_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (ring->cq_ptr == MAP_FAILED) {
+      UnmapRing(ring->sq_ptr, ring->sq_size);
+      ring->sq_ptr = ring->cq_ptr = nullptr;
+      close(fd);
+      return false;
+    }
+  }
+  ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes = static_cast<struct io_uring_sqe*>(
+      mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+  if (ring->sqes == MAP_FAILED) {
+    UnmapRing(ring->sq_ptr, ring->sq_size);
+    if (!single_mmap) UnmapRing(ring->cq_ptr, ring->cq_size);
+    ring->sq_ptr = ring->cq_ptr = nullptr;
+    ring->sqes = nullptr;
+    close(fd);
+    return false;
+  }
+  char* sq = static_cast<char*>(ring->sq_ptr);
+  char* cq = static_cast<char*>(ring->cq_ptr);
+  ring->sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring->sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring->sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring->sq_entries =
+      *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+  ring->sq_tail_local = *ring->sq_tail;
+  // Submission queue entries are always submitted in order, so the index
+  // array is set up once as an identity mapping.
+  unsigned* sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  for (unsigned i = 0; i < ring->sq_entries; ++i) {
+    sq_array[i] = i;
+  }
+  ring->cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring->cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring->cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring->cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+  ring->ring_fd = fd;
+  return true;
+}
+
+void TeardownRing(IoUringQueues* ring) {
+  if (ring->ring_fd < 0) return;
+  UnmapRing(ring->sqes, ring->sqes_size);
+  if (ring->cq_ptr != ring->sq_ptr) UnmapRing(ring->cq_ptr, ring->cq_size);
+  UnmapRing(ring->sq_ptr, ring->sq_size);
+  close(ring->ring_fd);
+  ring->ring_fd = -1;
+  ring->sq_ptr = ring->cq_ptr = nullptr;
+  ring->sqes = nullptr;
+}
+
+// It is possible that the kernel headers support io_uring but the running
+// kernel doesn't, or that it has been disabled (e.g. by seccomp or the
+// kernel.io_uring_disabled sysctl). Create a ring and register a multishot
+// poll on a wakeup fd to make sure every feature used by this poller is
+// available.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  IoUringQueues ring;
+  if (!SetupRing(&ring)) {
+    return false;
+  }
+  auto wakeup_fd = CreateWakeupFd();
+  if (!wakeup_fd.ok()) {
+    TeardownRing(&ring);
+    return false;
+  }
+  struct io_uring_sqe* sqe = &ring.sqes[ring.sq_tail_local & ring.sq_mask];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = (*wakeup_fd)->ReadFd();
+  sqe->poll32_events = PollEvents(POLLIN);
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = 1;
+  __atomic_store_n(ring.sq_tail, ++ring.sq_tail_local, __ATOMIC_RELEASE);
+  bool supported = false;
+  if ((*wakeup_fd)->Wakeup().ok() &&
+      IoUringEnter(ring.ring_fd, 1, 1, IORING_ENTER_GETEVENTS, nullptr, 0) ==
+          1) {
+    unsigned head = *ring.cq_head;
+    if (head != __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE)) {
+      struct io_uring_cqe* cqe = &ring.cqes[head & ring.cq_mask];
+      supported = cqe->res > 0 && (cqe->flags & IORING_CQE_F_MORE) != 0;
+    }
+  }
+  if (!supported) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring: kernel lacks multishot poll support";
+  }
+  // Closing the ring cancels the outstanding poll request.
+  TeardownRing(&ring);
+  if (supported && grpc_core::Fork::Enabled()) {
+    if (grpc_core::Fork::RegisterResetChildPollingEngineFunc(
+            ResetEventManagerOnFork)) {
+      gpr_mu_init(&fork_poller_list_mu);
+    }
+  }
+  return supported;
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  bool is_release_fd = (release_fd != nullptr);
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+
+  // Unlike epoll, closing the fd does not stop polling it: the poll request
+  // holds a reference to the file. Cancel the request before the fd is
+  // closed or handed back to the caller.
+  {
+    grpc_core::MutexLock lock(&poll_mu_);
+    orphan_started_ = true;
+    if (poll_armed_) {
+      poller_->CancelPoll(user_data_);
+    }
+  }
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (is_release_fd) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+
+  {
+    // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  bool release_handle;
+  {
+    grpc_core::MutexLock lock(&poll_mu_);
+    orphan_done_ = true;
+    release_handle = !poll_armed_;
+  }
+  if (release_handle) {
+    poller_->ReleaseHandle(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler),
+      write_queue_(scheduler,
+                   grpc_core::ConfigVars::Get().PollerWriteBatchSize()),
+      read_scheduler_(scheduler,
+                      std::chrono::microseconds(
+                          grpc_core::ConfigVars::Get().PollerInlineBudgetUs())),
+      was_kicked_(false),
+      closed_(false) {
+  CHECK(SetupRing(&ring_));
+  wakeup_fd_ = *CreateWakeupFd();
+  CHECK(wakeup_fd_ != nullptr);
+  GRPC_TRACE_LOG(event_engine_poller, INFO)
+      << "grpc io_uring fd: " << ring_.ring_fd;
+  CHECK(ArmPoll(wakeup_fd_->ReadFd(), POLLIN,
+                reinterpret_cast<uint64_t>(wakeup_fd_.get())));
+  SubmitPending();
+  ring_.num_events = 0;
+  ring_.cursor = 0;
+  ForkPollerListAddPoller(this);
+}
+
+void IoUringPoller::Shutdown() { ForkPollerListRemovePoller(this); }
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+
+  // Closing the ring cancels every outstanding request, so orphaned handles
+  // still waiting for their poll request to terminate can be deleted as well.
+  // In a forked child this only drops the child's reference to the ring: the
+  // requests of the parent are left alone.
+  {
+    grpc_core::MutexLock sq_lock(&sq_mu_);
+    TeardownRing(&ring_);
+  }
+  ring_.num_events = 0;
+  ring_.cursor = 0;
+
+  free_io_uring_handles_list_.clear();
+  for (IoUringEventHandle* handle : all_handles_) {
+    if (handle->OrphanDone()) {
+      delete handle;
+    }
+  }
+  all_handles_.clear();
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+struct io_uring_sqe* IoUringPoller::GetSqe() {
+  unsigned head = __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  if (ring_.sq_tail_local - head >= ring_.sq_entries) {
+    return nullptr;
+  }
+  struct io_uring_sqe* sqe = &ring_.sqes[ring_.sq_tail_local & ring_.sq_mask];
+  ++ring_.sq_tail_local;
+  memset(sqe, 0, sizeof(*sqe));
+  return sqe;
+}
+
+void IoUringPoller::SubmitLocked() {
+  __atomic_store_n(ring_.sq_tail, ring_.sq_tail_local, __ATOMIC_RELEASE);
+  unsigned to_submit =
+      ring_.sq_tail_local - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  while (to_submit > 0) {
+    int r = IoUringEnter(ring_.ring_fd, to_submit, 0, 0, nullptr, 0);
+    if (r < 0) {
+      if (errno == EINTR) continue;
+      // EAGAIN/EBUSY: the kernel is temporarily out of resources or the
+      // completion queue is overflowing. The entries stay queued and are
+      // flushed by the next wait.
+      if (errno == EAGAIN || errno == EBUSY) return;
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) IoUringPoller:%p encountered io_uring_enter "
+          "error: %s",
+          this, grpc_core::StrError(errno).c_str()));
+    }
+    to_submit -= std::min<unsigned>(to_submit, r);
+  }
+}
+
+bool IoUringPoller::ArmPoll(int fd, uint32_t events, uint64_t user_data) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (ring_.ring_fd < 0) return false;
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) {
+    // The submission queue is full: flush it and try again.
+    SubmitLocked();
+    sqe = GetSqe();
+    if (sqe == nullptr) return false;
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll32_events = PollEvents(events);
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = user_data;
+  return true;
+}
+
+void IoUringPoller::CancelPoll(uint64_t user_data) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (ring_.ring_fd < 0) return;
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) {
+    SubmitLocked();
+    sqe = GetSqe();
+    CHECK_NE(sqe, nullptr);
+  }
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = kIgnoredUserData;
+  // The removal must reach the kernel before the fd is closed or released.
+  SubmitLocked();
+}
+
+void IoUringPoller::SubmitPending() {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (ring_.ring_fd < 0) return;
+  SubmitLocked();
+}
+
+void IoUringPoller::ReleaseHandle(IoUringEventHandle* handle) {
+  grpc_core::MutexLock lock(&mu_);
+  free_io_uring_handles_list_.push_back(handle);
+}
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, track_err, this);
+      all_handles_.push_back(new_handle);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+  }
+  new_handle->Arm();
+  // The poller may be blocked waiting for completions, so the registration
+  // is submitted right away instead of waiting for the next wait.
+  SubmitPending();
+  return new_handle;
+}
+
+// Process the completions found by DoIoUringWait() function.
+// - ring_.cursor points to the index of the first completion to be processed
+// - This function then processes up-to max_events_to_handle and updates
+//   ring_.cursor.
+// It returns true, it there was a Kick that forced invocation of this
+// function. It also returns the list of handles that have pending actions.
+bool IoUringPoller::ProcessIoUringEvents(int max_events_to_handle,
+                                         Events& pending_events) {
+  int64_t num_events = ring_.num_events;
+  int64_t cursor = ring_.cursor;
+  bool was_kicked = false;
+  for (int idx = 0; (idx < max_events_to_handle) && cursor != num_events;
+       idx++) {
+    int64_t c = cursor++;
+    struct io_uring_cqe* cqe = &ring_.events[c];
+    uint64_t user_data = cqe->user_data;
+    bool terminated = (cqe->flags & IORING_CQE_F_MORE) == 0;
+    if (user_data == kIgnoredUserData) {
+      continue;
+    }
+    if (user_data == reinterpret_cast<uint64_t>(wakeup_fd_.get())) {
+      if (terminated && !closed_) {
+        CHECK(ArmPoll(wakeup_fd_->ReadFd(), POLLIN, user_data));
+      }
+      if (cqe->res > 0 && (cqe->res & POLLIN) != 0) {
+        CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+      }
+      continue;
+    }
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<intptr_t>(user_data) & ~intptr_t{1});
+    bool track_err = (user_data & 1) != 0;
+    int32_t res = cqe->res;
+    if (res > 0) {
+      uint32_t events = static_cast<uint32_t>(res);
+      bool cancel = (events & POLLHUP) != 0;
+      bool error = (events & POLLERR) != 0;
+      bool read_ev = (events & (POLLIN | POLLPRI)) != 0;
+      bool write_ev = (events & POLLOUT) != 0;
+      bool err_fallback = error && !track_err;
+      if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                    write_ev || cancel || err_fallback,
+                                    error && !err_fallback)) {
+        pending_events.push_back(handle);
+      }
+    } else if (res < 0 && res != -ECANCELED && res != -ENOENT) {
+      // The kernel refused to poll the fd. Wake up both directions so that
+      // the owner of the handle observes the error from its next syscall.
+      if (handle->SetPendingActions(true, true, false)) {
+        pending_events.push_back(handle);
+      }
+    }
+    if (terminated && handle->OnPollTerminated(res)) {
+      free_io_uring_handles_list_.push_back(handle);
+    }
+  }
+  ring_.cursor = cursor;
+  return was_kicked;
+}
+
+// Flush the queued submissions, wait for completions and copy them into
+// ring_.events. This does not "process" any of the completions yet; that is
+// done in ProcessIoUringEvents(). It returns the number of completions reaped.
+int IoUringPoller::DoIoUringWait(std::chrono::steady_clock::time_point deadline) {
+  unsigned to_submit;
+  {
+    grpc_core::MutexLock lock(&sq_mu_);
+    // The ring is gone once the poller is closed, e.g. in a forked child.
+    if (ring_.ring_fd < 0) return 0;
+    __atomic_store_n(ring_.sq_tail, ring_.sq_tail_local, __ATOMIC_RELEASE);
+    to_submit =
+        ring_.sq_tail_local - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+  }
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.sigmask_sz = _NSIG / 8;
+  arg.ts = reinterpret_cast<uint64_t>(&ts);
+  int r;
+  do {
+    // A wait interrupted by a signal only waits for what is left of the
+    // timeout when it is retried.
+    int64_t timeout_ns = std::max<int64_t>(
+        0, std::chrono::duration_cast<std::chrono::nanoseconds>(
+               deadline - std::chrono::steady_clock::now())
+               .count());
+    ts.tv_sec = timeout_ns / GPR_NS_PER_SEC;
+    ts.tv_nsec = timeout_ns % GPR_NS_PER_SEC;
+    // Submitting the queued requests and waiting for completions happens in
+    // a single syscall.
+    r = IoUringEnter(ring_.ring_fd, to_submit, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+    if (r >= 0) to_submit -= std::min<unsigned>(to_submit, r);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0 && errno != ETIME && errno != EBUSY && errno != EAGAIN) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  int n = 0;
+  while (head != tail && n < MAX_IO_URING_EVENTS) {
+    ring_.events[n++] = ring_.cqes[head & ring_.cq_mask];
+    ++head;
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  ring_.num_events = n;
+  ring_.cursor = 0;
+  return n;
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  // See Epoll1EventHandle::ShutdownHandle for why a mutex is required here.
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  const auto now = std::chrono::steady_clock::now();
+  const auto deadline =
+      now + std::min<EventEngine::Duration>(
+                timeout, std::chrono::steady_clock::time_point::max() - now);
+  // Unlike epoll, some completions carry no event for any handle (e.g. the
+  // completion of a poll removal). Keep waiting, until the deadline, for
+  // something to report so that an empty batch is not mistaken for a Kick.
+  do {
+    if (ring_.cursor == ring_.num_events) {
+      if (DoIoUringWait(deadline) == 0) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
+    }
+    grpc_core::MutexLock lock(&mu_);
+    // If was_kicked_ is true, collect all pending events in this iteration.
+    if (ProcessIoUringEvents(
+            was_kicked_ ? INT_MAX : MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION,
+            pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+  } while (pending_events.empty() && !was_kicked_ext);
+  if (pending_events.empty()) {
+    return Poller::WorkResult::kKicked;
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline. The write closures made ready here are
+  // flushed together once all events have been processed, and then the
+  // non-blocking read closures are run on this thread, within budget.
+  {
+    PollerInlineScheduler::Pass read_pass(&read_scheduler_);
+    PollerWriteQueue::Batch write_batch(&write_queue_);
+    for (auto& it : pending_events) {
+      it->ExecutePendingActions();
+    }
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return std::make_shared<IoUringPoller>(scheduler);
+  }
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+// The parent keeps its ring: the wakeup written by PrepareFork makes the
+// polling thread go around once, which is harmless.
+void IoUringPoller::PostforkParent() {}
+
+// The ring is shared with the parent, which still owns the requests queued on
+// it, so the child closes its copy instead of polling on it.
+void IoUringPoller::PostforkChild() { Close(); }
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_LINUX_IO_URING)
+#if defined(GRPC_POSIX_SOCKET_EV)
+
+namespace grpc_event_engine::experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */)
+    : write_queue_(nullptr, 0),
+      read_scheduler_(nullptr, std::chrono::microseconds(0)) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::ProcessIoUringEvents(int /*max_events_to_handle*/,
+                                         Events& /*pending_events*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+int IoUringPoller::DoIoUringWait(
+    std::chrono::steady_clock::time_point /*deadline*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::ArmPoll(int /*fd*/, uint32_t /*events*/,
+                            uint64_t /*user_data*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::CancelPoll(uint64_t /*user_data*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::SubmitPending() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::ReleaseHandle(IoUringEventHandle* /*handle*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+// If GRPC_LINUX_IO_URING is not defined, it means io_uring is not available.
+// Return nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() {}
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // defined(GRPC_POSIX_SOCKET_EV)
+#endif  // !defined(GRPC_LINUX_IO_URING)
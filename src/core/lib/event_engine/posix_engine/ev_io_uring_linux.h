@@ -0,0 +1,194 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/event_engine/posix_engine/poller_inline_scheduler.h"
+#include "src/core/lib/event_engine/posix_engine/poller_write_queue.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/sync.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+#define MAX_IO_URING_EVENTS 100
+
+namespace grpc_event_engine::experimental {
+
+class IoUringEventHandle;
+
+#ifdef GRPC_LINUX_IO_URING
+// The memory mapped submission and completion rings of an io_uring instance.
+struct IoUringQueues {
+  int ring_fd = -1;
+
+  // Submission queue. sq_tail_local is the tail of the entries queued by this
+  // process, which are published to the kernel through *sq_tail.
+  void* sq_ptr = nullptr;
+  size_t sq_size = 0;
+  unsigned* sq_head = nullptr;
+  unsigned* sq_tail = nullptr;
+  unsigned sq_mask = 0;
+  unsigned sq_entries = 0;
+  unsigned sq_tail_local = 0;
+  struct io_uring_sqe* sqes = nullptr;
+  size_t sqes_size = 0;
+
+  // Completion queue.
+  void* cq_ptr = nullptr;
+  size_t cq_size = 0;
+  unsigned* cq_head = nullptr;
+  unsigned* cq_tail = nullptr;
+  unsigned cq_mask = 0;
+  struct io_uring_cqe* cqes = nullptr;
+};
+#endif
+
+// Definition of an io_uring based poller.
+//
+// Fd readiness is tracked with multishot IORING_OP_POLL_ADD requests, so
+// handles keep the edge-triggered semantics of the epoll1 poller. Poll
+// registrations, re-arms and removals are queued on the submission ring and
+// flushed together with the wait for completions in a single io_uring_enter
+// call. Completions are read from the completion ring shared with the kernel,
+// so draining a burst of events does not need additional syscalls.
+//
+// Only readiness goes through the ring: endpoints and listeners still issue
+// recvmsg/sendmsg/accept4 themselves once an fd is reported ready.
+//
+// After fork, the child closes its pollers instead of sharing their rings with
+// the parent.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  // Forkable
+  void PrepareFork() override;
+  void PostforkParent() override;
+  void PostforkChild() override;
+
+  void Close();
+
+ private:
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  friend class IoUringEventHandle;
+  // Process the completions reaped by DoIoUringWait() function.
+  // - ring_.cursor points to the index of the first completion to be processed
+  // - This function then processes up-to max_events_to_handle and updates
+  //   ring_.cursor.
+  // It returns true, it there was a Kick that forced invocation of this
+  // function. It also returns the list of handles that have pending actions.
+  bool ProcessIoUringEvents(int max_events_to_handle, Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Flush queued submissions, wait for at least one completion (or until the
+  // deadline) and copy the available completions into ring_.events. It
+  // returns the number of completions reaped.
+  int DoIoUringWait(std::chrono::steady_clock::time_point deadline);
+  // Queue a multishot poll request for the given events on fd, tagged with
+  // user_data. Returns false if the ring could not accept the request.
+  bool ArmPoll(int fd, uint32_t events, uint64_t user_data)
+      ABSL_LOCKS_EXCLUDED(sq_mu_);
+  // Queue the removal of the poll request tagged with user_data and submit it
+  // right away.
+  void CancelPoll(uint64_t user_data) ABSL_LOCKS_EXCLUDED(sq_mu_);
+  // Submit every queued request without waiting for completions.
+  void SubmitPending() ABSL_LOCKS_EXCLUDED(sq_mu_);
+  // Return an orphaned handle whose poll request has terminated to the free
+  // list.
+  void ReleaseHandle(IoUringEventHandle* handle) ABSL_LOCKS_EXCLUDED(mu_);
+#ifdef GRPC_LINUX_IO_URING
+  struct Ring : public IoUringQueues {
+    // The completions reaped by the last call to DoIoUringWait()
+    struct io_uring_cqe events[MAX_IO_URING_EVENTS]{};
+
+    // The number of completions reaped by the last call to DoIoUringWait()
+    int num_events = 0;
+
+    // Index of the first completion in events that has to be processed. This
+    // field is only valid if num_events > 0
+    int cursor = 0;
+  };
+  // Returns the next free submission queue entry or nullptr if the
+  // submission queue is full.
+  struct io_uring_sqe* GetSqe() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Publish queued entries to the kernel and submit them.
+  void SubmitLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+#else
+  struct Ring {};
+#endif
+  grpc_core::Mutex mu_;
+  // Serializes producers of the submission queue.
+  grpc_core::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  // Schedules the write closures of the handles, batching the ones that
+  // become ready during the same Work() pass.
+  PollerWriteQueue write_queue_;
+  // Schedules the read closures of the handles, running the non-blocking ones
+  // that become ready during a Work() pass on the polling thread.
+  PollerInlineScheduler read_scheduler_;
+  Ring ring_;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  // Every handle ever created by this poller. Orphaned handles are deleted in
+  // Close().
+  std::vector<IoUringEventHandle*> all_handles_ ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<WakeupFd> wakeup_fd_;
+  bool closed_;
+};
+
+// Return an instance of a io_uring based poller tied to the specified
+// scheduler. It returns nullptr if the running kernel does not support the
+// io_uring features this poller depends on.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
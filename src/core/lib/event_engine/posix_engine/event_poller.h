@@ -32,6 +32,11 @@ class Scheduler {
  public:
   virtual void Run(experimental::EventEngine::Closure* closure) = 0;
   virtual void Run(absl::AnyInvocable<void()>) = 0;
+  // Runs a closure that is known not to block. Implementations may run it on
+  // the calling thread.
+  virtual void RunNonBlocking(experimental::EventEngine::Closure* closure) {
+    Run(closure);
+  }
   virtual ~Scheduler() = default;
 };
 
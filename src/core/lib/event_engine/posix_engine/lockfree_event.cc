@@ -234,7 +234,11 @@ void LockfreeEvent::SetReady() {
           // notify_on (or set_shutdown)
           auto closure = reinterpret_cast<PosixEngineClosure*>(curr);
           closure->SetStatus(absl::OkStatus());
-          scheduler_->Run(closure);
+          if (closure->is_non_blocking()) {
+            scheduler_->RunNonBlocking(closure);
+          } else {
+            scheduler_->Run(closure);
+          }
           return;
         }
         // else the state changed again (only possible by either a racing
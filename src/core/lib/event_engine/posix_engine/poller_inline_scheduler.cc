@@ -0,0 +1,72 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/poller_inline_scheduler.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// The pass that is open on the current thread, if any.
+thread_local PollerInlineScheduler::Pass* g_current_pass = nullptr;
+}  // namespace
+
+PollerInlineScheduler::Pass::Pass(PollerInlineScheduler* scheduler)
+    : scheduler_(scheduler) {
+  if (!scheduler_->InliningEnabled()) return;
+  CHECK_EQ(g_current_pass, nullptr);
+  g_current_pass = this;
+}
+
+PollerInlineScheduler::Pass::~Pass() {
+  if (g_current_pass != this) return;
+  g_current_pass = nullptr;
+  if (closures_.empty()) return;
+  const auto deadline = std::chrono::steady_clock::now() + scheduler_->budget_;
+  size_t i = 0;
+  while (i < closures_.size()) {
+    closures_[i++]->Run();
+    if (std::chrono::steady_clock::now() >= deadline) break;
+  }
+  for (; i < closures_.size(); i++) {
+    scheduler_->scheduler_->Run(closures_[i]);
+  }
+}
+
+void PollerInlineScheduler::Run(EventEngine::Closure* closure) {
+  scheduler_->Run(closure);
+}
+
+void PollerInlineScheduler::Run(absl::AnyInvocable<void()> closure) {
+  scheduler_->Run(std::move(closure));
+}
+
+void PollerInlineScheduler::RunNonBlocking(EventEngine::Closure* closure) {
+  Pass* pass = g_current_pass;
+  if (pass != nullptr && pass->scheduler_ == this) {
+    pass->closures_.push_back(closure);
+    return;
+  }
+  scheduler_->Run(closure);
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,76 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POLLER_INLINE_SCHEDULER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POLLER_INLINE_SCHEDULER_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <chrono>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+
+namespace grpc_event_engine::experimental {
+
+// Scheduler for the read closures of the handles of a poller.
+//
+// Non-blocking closures (see Scheduler::RunNonBlocking) that become ready while
+// a poller thread dispatches the events of one Work() pass (see Pass) are run
+// on the poller thread itself once the pass is over, instead of being handed
+// to the thread pool. This saves a thread pool hop and the wakeup of a worker
+// thread per read. Pollers call schedule_poll_again before dispatching events,
+// so another thread keeps polling meanwhile.
+//
+// The inline closures of a pass run back to back until budget has elapsed;
+// the ones left are then scheduled on the underlying scheduler. All other
+// closures are forwarded to the underlying scheduler right away.
+class PollerInlineScheduler : public Scheduler {
+ public:
+  // Running closures inline is disabled if budget is not positive.
+  PollerInlineScheduler(Scheduler* scheduler, std::chrono::microseconds budget)
+      : scheduler_(scheduler), budget_(budget) {}
+
+  void Run(EventEngine::Closure* closure) override;
+  void Run(absl::AnyInvocable<void()> closure) override;
+  void RunNonBlocking(EventEngine::Closure* closure) override;
+
+  bool InliningEnabled() const { return budget_.count() > 0; }
+
+  // Collects the non-blocking closures that become ready on the current thread
+  // while it is alive, and runs them when it goes out of scope. Passes may not
+  // be nested.
+  class Pass {
+   public:
+    explicit Pass(PollerInlineScheduler* scheduler);
+    ~Pass();
+
+    Pass(const Pass&) = delete;
+    Pass& operator=(const Pass&) = delete;
+
+   private:
+    friend class PollerInlineScheduler;
+    PollerInlineScheduler* scheduler_;
+    std::vector<EventEngine::Closure*> closures_;
+  };
+
+ private:
+  Scheduler* scheduler_;
+  const std::chrono::microseconds budget_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POLLER_INLINE_SCHEDULER_H
@@ -0,0 +1,76 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/poller_write_queue.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+// The batch that is open on the current thread, if any.
+thread_local PollerWriteQueue::Batch* g_current_batch = nullptr;
+}  // namespace
+
+PollerWriteQueue::Batch::Batch(PollerWriteQueue* queue) : queue_(queue) {
+  if (!queue_->BatchingEnabled()) return;
+  CHECK_EQ(g_current_batch, nullptr);
+  g_current_batch = this;
+}
+
+PollerWriteQueue::Batch::~Batch() {
+  if (g_current_batch != this) return;
+  g_current_batch = nullptr;
+  if (!closures_.empty()) queue_->Flush(std::move(closures_));
+}
+
+void PollerWriteQueue::Run(EventEngine::Closure* closure) {
+  Batch* batch = g_current_batch;
+  if (batch != nullptr && batch->queue_ == this) {
+    batch->closures_.push_back(closure);
+    return;
+  }
+  scheduler_->Run(closure);
+}
+
+void PollerWriteQueue::Run(absl::AnyInvocable<void()> closure) {
+  scheduler_->Run(std::move(closure));
+}
+
+void PollerWriteQueue::Flush(std::vector<EventEngine::Closure*> closures) {
+  if (closures.size() == 1) {
+    scheduler_->Run(closures.front());
+    return;
+  }
+  const size_t batch_size = static_cast<size_t>(max_batch_size_);
+  for (size_t begin = 0; begin < closures.size(); begin += batch_size) {
+    const size_t end = std::min(begin + batch_size, closures.size());
+    scheduler_->Run(
+        [batch = std::vector<EventEngine::Closure*>(
+             closures.begin() + begin, closures.begin() + end)]() {
+          for (EventEngine::Closure* closure : batch) {
+            closure->Run();
+          }
+        });
+  }
+}
+
+}  // namespace grpc_event_engine::experimental
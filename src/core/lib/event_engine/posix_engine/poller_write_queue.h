@@ -0,0 +1,74 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POLLER_WRITE_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POLLER_WRITE_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+
+namespace grpc_event_engine::experimental {
+
+// Scheduler for the write closures of the handles of a poller.
+//
+// Write closures that become ready while a poller thread dispatches the events
+// of one Work() pass (see Batch) are queued instead of being scheduled one by
+// one. When the pass is over, the queue is flushed: the closures are run back
+// to back by as few scheduled callbacks as possible, each running up to
+// max_batch_size closures. With many connections becoming writable at once,
+// this trades one thread pool hop (and possibly one thread wakeup) per fd for
+// one per batch. Closures that become ready outside of a pass are forwarded to
+// the underlying scheduler right away.
+class PollerWriteQueue : public Scheduler {
+ public:
+  // Batching is disabled if max_batch_size is less than 2.
+  PollerWriteQueue(Scheduler* scheduler, int max_batch_size)
+      : scheduler_(scheduler), max_batch_size_(max_batch_size) {}
+
+  void Run(EventEngine::Closure* closure) override;
+  void Run(absl::AnyInvocable<void()> closure) override;
+
+  bool BatchingEnabled() const { return max_batch_size_ > 1; }
+
+  // Queues the write closures that become ready on the current thread while it
+  // is alive, and flushes them when it goes out of scope. Batches may not be
+  // nested.
+  class Batch {
+   public:
+    explicit Batch(PollerWriteQueue* queue);
+    ~Batch();
+
+    Batch(const Batch&) = delete;
+    Batch& operator=(const Batch&) = delete;
+
+   private:
+    friend class PollerWriteQueue;
+    PollerWriteQueue* queue_;
+    std::vector<EventEngine::Closure*> closures_;
+  };
+
+ private:
+  void Flush(std::vector<EventEngine::Closure*> closures);
+
+  Scheduler* scheduler_;
+  const int max_batch_size_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POLLER_WRITE_QUEUE_H
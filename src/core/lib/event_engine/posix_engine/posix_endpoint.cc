@@ -30,6 +30,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
@@ -46,6 +47,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/load_file.h"
@@ -61,6 +63,7 @@
 #include <linux/capability.h>  // IWYU pragma: keep
 #include <linux/errqueue.h>    // IWYU pragma: keep
 #include <linux/netlink.h>     // IWYU pragma: keep
+#include <sys/mman.h>          // IWYU pragma: keep
 #include <sys/prctl.h>         // IWYU pragma: keep
 #include <sys/resource.h>      // IWYU pragma: keep
 #endif
@@ -75,6 +78,12 @@
 #define TCP_CM_INQ TCP_INQ
 #endif
 
+#ifdef GRPC_LINUX_ERRQUEUE
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+#endif  // GRPC_LINUX_ERRQUEUE
+
 #ifdef GRPC_HAVE_MSG_NOSIGNAL
 #define SENDMSG_FLAGS MSG_NOSIGNAL
 #else
@@ -209,6 +218,44 @@ bool CmsgIsZeroCopy(const cmsghdr& cmsg) {
   auto serr = reinterpret_cast<const sock_extended_err*> CMSG_DATA(&cmsg);
   return serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY;
 }
+
+// The leading fields of struct tcp_zerocopy_receive from <linux/tcp.h>. The
+// kernel accepts this prefix of the structure, so the code compiles against
+// headers that do not define it.
+struct TcpZerocopyReceiveArgs {
+  uint64_t address;
+  uint32_t length;
+  uint32_t recv_skip_hint;
+};
+
+size_t PageSize() {
+  static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return kPageSize;
+}
+
+// Reference count of a slice that points into pages mapped by
+// TCP_ZEROCOPY_RECEIVE. Keeps the pages charged to the memory allocator of the
+// endpoint that received them until the slice is destroyed.
+class ZerocopyReceivedPages final : public grpc_slice_refcount {
+ public:
+  ZerocopyReceivedPages(void* pages, size_t length,
+                        MemoryAllocator::Reservation reservation)
+      : grpc_slice_refcount(Destroy),
+        pages_(pages),
+        length_(length),
+        reservation_(std::move(reservation)) {}
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* received = static_cast<ZerocopyReceivedPages*>(p);
+    munmap(received->pages_, received->length_);
+    delete received;
+  }
+
+  void* const pages_;
+  const size_t length_;
+  MemoryAllocator::Reservation reservation_;
+};
 #endif  // GRPC_LINUX_ERRQUEUE
 
 absl::Status PosixOSError(int error_no, absl::string_view call_name) {
@@ -218,6 +265,18 @@ absl::Status PosixOSError(int error_no, absl::string_view call_name) {
 
 }  // namespace
 
+#ifdef GRPC_LINUX_ERRQUEUE
+Slice MakeZerocopyReceivedSlice(void* pages, size_t length,
+                                MemoryAllocator& allocator) {
+  grpc_slice slice;
+  slice.refcount = new ZerocopyReceivedPages(
+      pages, length, allocator.MakeReservation(MemoryRequest(length)));
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(pages);
+  slice.data.refcounted.length = length;
+  return Slice(slice);
+}
+#endif  // GRPC_LINUX_ERRQUEUE
+
 #if defined(IOV_MAX) && IOV_MAX < 260
 #define MAX_WRITE_IOVEC IOV_MAX
 #else
@@ -270,6 +329,16 @@ void PosixEndpointImpl::FinishEstimate() {
   // the target buffer to either the amount read, or twice its previous value.
   if (bytes_read_this_round_ > target_length_ * 0.8) {
     target_length_ = std::max(2 * target_length_, bytes_read_this_round_);
+    // If the transport knows how much data the link keeps in flight, grow
+    // straight to it instead of doubling one read loop at a time, and not past
+    // the bound ApplyBdpEstimate keeps the estimate within.
+    const int64_t bdp = bdp_estimate_.load(std::memory_order_relaxed);
+    if (bdp > 0) {
+      target_length_ = std::max(
+          target_length_,
+          static_cast<double>(std::min<int64_t>(bdp, max_read_chunk_size_)));
+      CapReadTargetAtBdp(bdp);
+    }
   } else {
     target_length_ = 0.99 * target_length_ + 0.01 * bytes_read_this_round_;
   }
@@ -284,6 +353,61 @@ absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
   return src_error;
 }
 
+size_t PosixEndpointImpl::TcpZerocopyReceive(size_t length,
+                                             SliceBuffer& buffer) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  length = std::min(length, static_cast<size_t>(max_read_chunk_size_));
+  length = (length + PageSize() - 1) / PageSize() * PageSize();
+  // Each receive gets its own mapping so that the received pages can outlive
+  // the next read: the slice handed to the application owns the mapping.
+  void* region = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd_, 0);
+  if (region == MAP_FAILED) {
+    VLOG(2) << "Disabling rx zero-copy on fd=" << fd_
+            << ", mmap failed: " << grpc_core::StrError(errno);
+    rx_zerocopy_enabled_ = false;
+    return 0;
+  }
+  TcpZerocopyReceiveArgs zc{};
+  zc.address = reinterpret_cast<uintptr_t>(region);
+  zc.length = static_cast<uint32_t>(length);
+  socklen_t zc_len = sizeof(zc);
+  int r;
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    r = getsockopt(fd_, IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) {
+    int saved_errno = errno;
+    munmap(region, length);
+    if (saved_errno == EINVAL || saved_errno == ENOPROTOOPT ||
+        saved_errno == EOPNOTSUPP) {
+      VLOG(2) << "Disabling rx zero-copy on fd=" << fd_
+              << ", TCP_ZEROCOPY_RECEIVE failed: "
+              << grpc_core::StrError(saved_errno);
+      rx_zerocopy_enabled_ = false;
+    }
+    // Any other error is reported by the recvmsg that follows.
+    return 0;
+  }
+  // The kernel maps whole pages only, so the mapped length is a multiple of
+  // the page size. Release the part of the region that was not used.
+  const size_t mapped = zc.length;
+  if (mapped < length) {
+    munmap(static_cast<char*>(region) + mapped, length - mapped);
+  }
+  if (mapped == 0) {
+    return 0;
+  }
+  grpc_core::global_stats().IncrementTcpReadSize(mapped);
+  buffer.Append(MakeZerocopyReceivedSlice(region, mapped, memory_owner_));
+  return mapped;
+#else
+  (void)length;
+  (void)buffer;
+  return 0;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
 // Returns true if data available to read or error other than EAGAIN.
 bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   GRPC_LATENT_SEE_INNER_SCOPE("TcpDoRead");
@@ -310,6 +434,21 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   CHECK_NE(incoming_buffer_->Length(), 0u);
   DCHECK_GT(min_progress_size_, 0);
 
+  // Large reads first map whatever page aligned data is available. Bytes that
+  // cannot be mapped are then read with recvmsg below, which also consumes the
+  // edge.
+  SliceBuffer zerocopy_buffer;
+  size_t zerocopy_read_bytes = 0;
+  if (rx_zerocopy_enabled_) {
+    const size_t expected_bytes = static_cast<size_t>(
+        std::max({static_cast<double>(min_progress_size_),
+                  static_cast<double>(inq_), target_length_}));
+    if (expected_bytes >= rx_zerocopy_threshold_) {
+      zerocopy_read_bytes = TcpZerocopyReceive(expected_bytes, zerocopy_buffer);
+      AddToEstimate(zerocopy_read_bytes);
+    }
+  }
+
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
@@ -340,7 +479,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     if (read_bytes < 0 && errno == EAGAIN) {
       // NB: After calling call_read_cb a parallel call of the read handler may
       // be running.
-      if (total_read_bytes > 0) {
+      if (total_read_bytes > 0 || zerocopy_read_bytes > 0) {
         break;
       }
       FinishEstimate();
@@ -350,7 +489,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 
     // We have read something in previous reads. We need to deliver those bytes
     // to the upper layer.
-    if (read_bytes <= 0 && total_read_bytes >= 1) {
+    if (read_bytes <= 0 && (total_read_bytes >= 1 || zerocopy_read_bytes > 0)) {
       break;
     }
 
@@ -421,12 +560,16 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     inq_ = 1;
   }
 
-  DCHECK_GT(total_read_bytes, 0u);
+  DCHECK_GT(total_read_bytes + zerocopy_read_bytes, 0u);
   status = absl::OkStatus();
   if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
     // Update min progress size based on the total number of bytes read in
     // this round.
-    min_progress_size_ -= total_read_bytes;
+    min_progress_size_ -= total_read_bytes + zerocopy_read_bytes;
+    // Mapped bytes were received before the copied ones.
+    while (zerocopy_buffer.Count() > 0) {
+      last_read_buffer_.Append(zerocopy_buffer.TakeFirst());
+    }
     if (min_progress_size_ > 0) {
       // There is still some bytes left to be read before we can signal
       // the read as complete. Append the bytes read so far into
@@ -453,6 +596,12 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     incoming_buffer_->MoveLastNBytesIntoSliceBuffer(
         incoming_buffer_->Length() - total_read_bytes, last_read_buffer_);
   }
+  if (zerocopy_read_bytes > 0) {
+    // Mapped bytes were received before the copied ones.
+    incoming_buffer_->MoveFirstNBytesIntoSliceBuffer(total_read_bytes,
+                                                     zerocopy_buffer);
+    incoming_buffer_->Swap(zerocopy_buffer);
+  }
   return true;
 }
 
@@ -518,9 +667,47 @@ void PosixEndpointImpl::UpdateRcvLowat() {
   }
 }
 
+void PosixEndpointImpl::CapReadTargetAtBdp(int64_t bdp) {
+  // A read loop seldom finds more than a couple of BDPs worth of data queued
+  // on the socket. Allocating for more than that only pins memory, which adds
+  // up on mostly idle connections whose estimate decays slowly after a burst.
+  const double max_target = std::max<double>(
+      min_read_chunk_size_,
+      std::min<double>(2.0 * static_cast<double>(bdp), max_read_chunk_size_));
+  target_length_ = std::min(target_length_, max_target);
+}
+
+void PosixEndpointImpl::ApplyBdpEstimate() {
+  static constexpr int kRcvBufMin = 64 * 1024;
+  static constexpr int kRcvBufMax = 32 * 1024 * 1024;
+
+  const int64_t bdp = bdp_estimate_.load(std::memory_order_relaxed);
+  if (bdp <= 0) return;
+  CapReadTargetAtBdp(bdp);
+
+  if (!rcvbuf_from_bdp_) return;
+  const int rcvbuf = static_cast<int>(
+      std::clamp<int64_t>(2 * bdp, kRcvBufMin, kRcvBufMax));
+  // Only follow changes of at least 2x either way, the estimate is noisy and
+  // every change costs a syscall.
+  if (rcvbuf_from_bdp_size_ != 0 && rcvbuf < 2 * rcvbuf_from_bdp_size_ &&
+      2 * rcvbuf > rcvbuf_from_bdp_size_) {
+    return;
+  }
+  auto status = sock_.SetSocketRcvBuf(rcvbuf);
+  if (!status.ok()) {
+    VLOG(2) << "Disabling BDP based SO_RCVBUF sizing on fd=" << fd_ << ": "
+            << status;
+    rcvbuf_from_bdp_ = false;
+    return;
+  }
+  rcvbuf_from_bdp_size_ = rcvbuf;
+}
+
 void PosixEndpointImpl::MaybeMakeReadSlices() {
   static const int kBigAlloc = 64 * 1024;
   static const int kSmallAlloc = 8 * 1024;
+  ApplyBdpEstimate();
   if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
     size_t allocate_length = min_progress_size_;
     const size_t target_length = static_cast<size_t>(target_length_);
@@ -1325,6 +1512,18 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
       options.tcp_tx_zerocopy_send_bytes_threshold);
+#ifdef GRPC_LINUX_ERRQUEUE
+  // TCP_ZEROCOPY_RECEIVE support is probed on the first large read.
+  rx_zerocopy_enabled_ = options.tcp_rx_zero_copy_enabled &&
+                         local_address_.address()->sa_family != AF_UNIX;
+  rx_zerocopy_threshold_ = static_cast<size_t>(
+      std::max(options.tcp_rx_zerocopy_recv_bytes_threshold, 1));
+#endif  // GRPC_LINUX_ERRQUEUE
+  // An explicit GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE always wins.
+  rcvbuf_from_bdp_ =
+      options.tcp_receive_buffer_from_bdp &&
+      options.tcp_receive_buffer_size == PosixTcpOptions::kReadBufferSizeUnset &&
+      local_address_.address()->sa_family != AF_UNIX;
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
@@ -1339,6 +1538,10 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 
   on_read_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleRead(std::move(status)); });
+  // HandleRead invokes the caller's read callback inline, so it may only run
+  // on the poller thread when the caller has promised that callback does not
+  // block.
+  if (options.inline_read_callbacks) on_read_->SetNonBlocking();
   on_write_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleWrite(std::move(status)); });
   on_error_ = PosixEngineClosure::ToPermanentClosure(
@@ -24,6 +24,7 @@
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <memory>
@@ -462,6 +463,14 @@ class TcpZerocopySendCtx {
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
 };
 
+#ifdef GRPC_LINUX_ERRQUEUE
+// Returns a slice over `length` bytes of `pages` mapped by
+// TCP_ZEROCOPY_RECEIVE. The pages stay charged to `allocator` until the slice
+// is destroyed, which also unmaps them.
+Slice MakeZerocopyReceivedSlice(void* pages, size_t length,
+                                MemoryAllocator& allocator);
+#endif  // GRPC_LINUX_ERRQUEUE
+
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
  public:
   PosixEndpointImpl(
@@ -493,6 +502,17 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  void SetBdpEstimate(int64_t bdp_bytes) {
+    bdp_estimate_.store(std::max<int64_t>(bdp_bytes, 0),
+                        std::memory_order_relaxed);
+  }
+
+  // The number of bytes the next read is sized for.
+  double TestOnlyReadTargetLength() {
+    grpc_core::MutexLock lock(&read_mu_);
+    return target_length_;
+  }
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -505,7 +525,18 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   bool HandleReadLocked(absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Bounds the read size estimate by the latest BDP estimate and, if enabled,
+  // resizes SO_RCVBUF to match it.
+  void ApplyBdpEstimate() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  void CapReadTargetAtBdp(int64_t bdp);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Maps up to length bytes (rounded up to whole pages) of received data into
+  // buffer with TCP_ZEROCOPY_RECEIVE. Only page aligned data is mapped; the
+  // rest is left on the socket to be read with recvmsg. Returns the number of
+  // bytes appended to buffer.
+  size_t TcpZerocopyReceive(size_t length,
+                            grpc_event_engine::experimental::SliceBuffer& buffer)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -551,6 +582,19 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // Set if large reads should try TCP_ZEROCOPY_RECEIVE first. Cleared if the
+  // socket turns out not to support it.
+  bool rx_zerocopy_enabled_ ABSL_GUARDED_BY(read_mu_) = false;
+  // Zerocopy receives are only attempted when at least this many bytes are
+  // expected to be read.
+  size_t rx_zerocopy_threshold_ = 0;
+  // The bandwidth-delay product estimate reported by the transport, 0 if
+  // unknown.
+  std::atomic<int64_t> bdp_estimate_{0};
+  // Set if SO_RCVBUF should follow bdp_estimate_.
+  bool rcvbuf_from_bdp_ ABSL_GUARDED_BY(read_mu_) = false;
+  // The last SO_RCVBUF value derived from bdp_estimate_, 0 if none was set.
+  int rcvbuf_from_bdp_size_ ABSL_GUARDED_BY(read_mu_) = 0;
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
@@ -639,6 +683,14 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  void SetBdpEstimate(int64_t bdp_bytes) override {
+    impl_->SetBdpEstimate(bdp_bytes);
+  }
+
+  double TestOnlyReadTargetLength() {
+    return impl_->TestOnlyReadTargetLength();
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
@@ -700,6 +752,11 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
         "PosixEndpoint::CanTrackErrors not supported on this platform");
   }
 
+  void SetBdpEstimate(int64_t /*bdp_bytes*/) override {
+    grpc_core::Crash(
+        "PosixEndpoint::SetBdpEstimate not supported on this platform");
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     grpc_core::Crash("PosixEndpoint::Shutdown not supported on this platform");
@@ -39,6 +39,10 @@ class PosixEngineClosure final
         status_(absl::OkStatus()) {}
   ~PosixEngineClosure() final = default;
   void SetStatus(absl::Status status) { status_ = status; }
+  // Marks the callback as one that does not block, so that it may be run
+  // inline by the poller (see Scheduler::RunNonBlocking).
+  void SetNonBlocking() { is_non_blocking_ = true; }
+  bool is_non_blocking() const { return is_non_blocking_; }
   void Run() override {
     // We need to read the is_permanent_ variable before executing the
     // enclosed callback. This is because a permanent closure may delete this
@@ -69,6 +73,7 @@ class PosixEngineClosure final
  private:
   absl::AnyInvocable<void(absl::Status)> cb_;
   bool is_permanent_ = false;
+  bool is_non_blocking_ = false;
   absl::Status status_;
 };
 
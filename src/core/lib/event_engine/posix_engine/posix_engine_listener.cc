@@ -51,6 +51,14 @@
 
 namespace grpc_event_engine::experimental {
 
+namespace {
+// Maximum number of connections accepted from one listening socket before the
+// acceptor yields its thread. Handing the rest of the backlog to a freshly
+// scheduled closure keeps one busy socket from starving the other listener
+// shards and lets the accept work spread across the thread pool.
+constexpr int kMaxAcceptsPerNotification = 64;
+}  // namespace
+
 PosixEngineListenerImpl::PosixEngineListenerImpl(
     PosixEventEngineWithFdSupport::PosixAcceptCallback on_accept,
     absl::AnyInvocable<void(absl::Status)> on_shutdown,
@@ -113,7 +121,7 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
 
   auto result = CreateAndPrepareListenerSocket(options_, res_addr);
   GRPC_RETURN_IF_ERROR(result.status());
-  acceptors_.Append(*result);
+  ListenerContainerAppendSocket(acceptors_, options_, *result);
   return result->port;
 }
 
@@ -133,7 +141,15 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
     return;
   }
   // loop until accept4 returns EAGAIN, and then re-arm notification.
-  for (;;) {
+  for (int accepted = 0;; ++accepted) {
+    if (accepted == kMaxAcceptsPerNotification) {
+      // The backlog may not be drained yet. Re-arm the notification and mark
+      // the handle readable so that the remaining connections are accepted by
+      // a new closure run.
+      handle_->NotifyOnRead(notify_on_accept_);
+      handle_->SetReadable();
+      return;
+    }
     EventEngine::ResolvedAddress addr;
     memset(const_cast<sockaddr*>(addr.address()), 0, addr.size());
     // Note: If we ever decide to return this address to the user, remember to
@@ -166,6 +166,8 @@ absl::Status PrepareSocket(const PosixTcpOptions& options,
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketReuseAddr(1));
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketDscp(options.dscp));
     socket.sock.TrySetSocketTcpUserTimeout(options, false);
+    // Accepted connections inherit the busy poll settings.
+    socket.sock.TrySetSocketBusyPoll(options.busy_poll_us);
   }
   GRPC_RETURN_IF_ERROR(socket.sock.SetSocketNoSigpipeIfPossible());
   GRPC_RETURN_IF_ERROR(socket.sock.ApplySocketMutatorInOptions(
@@ -226,6 +228,31 @@ absl::StatusOr<ListenerSocket> CreateAndPrepareListenerSocket(
   return socket;
 }
 
+void ListenerContainerAppendSocket(ListenerSocketsContainer& listener_sockets,
+                                   const PosixTcpOptions& options,
+                                   const ListenerSocket& socket) {
+  listener_sockets.Append(socket);
+  if (options.listener_shards <= 1 || !options.allow_reuse_port ||
+      !PosixSocketWrapper::IsSocketReusePortSupported() ||
+      socket.addr.address()->sa_family == AF_UNIX ||
+      ResolvedAddressIsVSock(socket.addr)) {
+    return;
+  }
+  // The first socket may have been bound to an ephemeral port. Bind the shards
+  // to the port it actually got.
+  ResolvedAddress shard_addr = socket.addr;
+  ResolvedAddressSetPort(shard_addr, socket.port);
+  for (int i = 1; i < options.listener_shards; ++i) {
+    auto shard = CreateAndPrepareListenerSocket(options, shard_addr);
+    if (!shard.ok()) {
+      VLOG(2) << "Failed to add listener shard " << i << " for port "
+              << socket.port << ": " << shard.status();
+      return;
+    }
+    listener_sockets.Append(*shard);
+  }
+}
+
 absl::StatusOr<int> ListenerContainerAddAllLocalAddresses(
     ListenerSocketsContainer& listener_sockets, const PosixTcpOptions& options,
     int requested_port) {
@@ -288,7 +315,7 @@ absl::StatusOr<int> ListenerContainerAddAllLocalAddresses(
                        " due to error: ", result.status().message()));
       break;
     } else {
-      listener_sockets.Append(*result);
+      ListenerContainerAppendSocket(listener_sockets, options, *result);
       assigned_port = result->port;
       no_local_addresses = false;
     }
@@ -325,7 +352,7 @@ absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
   // Try listening on IPv6 first.
   v6_sock = CreateAndPrepareListenerSocket(options, wild6);
   if (v6_sock.ok()) {
-    listener_sockets.Append(*v6_sock);
+    ListenerContainerAppendSocket(listener_sockets, options, *v6_sock);
     requested_port = v6_sock->port;
     assigned_port = v6_sock->port;
     if (v6_sock->dsmode == PosixSocketWrapper::DSMODE_DUALSTACK ||
@@ -338,7 +365,7 @@ absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
   v4_sock = CreateAndPrepareListenerSocket(options, wild4);
   if (v4_sock.ok()) {
     assigned_port = v4_sock->port;
-    listener_sockets.Append(*v4_sock);
+    ListenerContainerAppendSocket(listener_sockets, options, *v4_sock);
   }
   if (assigned_port > 0) {
     if (!v6_sock.ok()) {
@@ -363,6 +390,14 @@ absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
 
 #else  // GRPC_POSIX_SOCKET_UTILS_COMMON
 
+void ListenerContainerAppendSocket(
+    ListenerSocketsContainer& /*listener_sockets*/,
+    const PosixTcpOptions& /*options*/,
+    const ListenerSocketsContainer::ListenerSocket& /*socket*/) {
+  grpc_core::Crash(
+      "ListenerContainerAppendSocket is not supported on this platform");
+}
+
 absl::StatusOr<ListenerSocketsContainer::ListenerSocket>
 CreateAndPrepareListenerSocket(const PosixTcpOptions& /*options*/,
                                const grpc_event_engine::experimental::
@@ -62,6 +62,16 @@ CreateAndPrepareListenerSocket(
     const PosixTcpOptions& options,
     const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr);
 
+// Adds the passed socket to the ListenerSocketsContainer. If
+// options.listener_shards is greater than 1 and SO_REUSEPORT can be used for
+// the socket's address, up to options.listener_shards - 1 additional sockets
+// bound to the same address and port are created and added as well, so that
+// the kernel distributes incoming connections among them. Failing to create an
+// additional socket is not an error: the listener keeps the sockets it has.
+void ListenerContainerAppendSocket(
+    ListenerSocketsContainer& listener_sockets, const PosixTcpOptions& options,
+    const ListenerSocketsContainer::ListenerSocket& socket);
+
 // Instead of creating and adding a socket bound to specific address, this
 // function creates and adds a socket bound to the wildcard address on the
 // server. The newly created socket is configured according to the passed
@@ -18,9 +18,11 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <limits.h>
 
+#include <algorithm>
 #include <optional>
 
 #include "absl/cleanup/cleanup.h"
@@ -137,6 +139,7 @@ absl::Status PrepareTcpClientSocket(PosixSocketWrapper sock,
     GRPC_RETURN_IF_ERROR(sock.SetSocketReuseAddr(1));
     GRPC_RETURN_IF_ERROR(sock.SetSocketDscp(options.dscp));
     sock.TrySetSocketTcpUserTimeout(options, true);
+    sock.TrySetSocketBusyPoll(options.busy_poll_us);
   }
   GRPC_RETURN_IF_ERROR(sock.SetSocketNoSigpipeIfPossible());
   GRPC_RETURN_IF_ERROR(sock.ApplySocketMutatorInOptions(
@@ -184,9 +187,21 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_receive_buffer_size =
       AdjustValue(PosixTcpOptions::kReadBufferSizeUnset, 0, INT_MAX,
                   config.GetInt(GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE));
+  options.tcp_receive_buffer_from_bdp =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RECEIVE_BUFFER_FROM_BDP)) != 0);
+  options.inline_read_callbacks =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_INLINE_READ_CALLBACKS)) != 0);
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(PosixTcpOptions::kZerocpRxEnabledDefault, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_rx_zerocopy_recv_bytes_threshold = AdjustValue(
+      PosixTcpOptions::kDefaultRecvBytesThreshold, 0, INT_MAX,
+      config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -203,6 +218,17 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.busy_poll_us =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_US));
+  options.listener_shards = AdjustValue(
+      PosixTcpOptions::kDefaultListenerShards, 0,
+      PosixTcpOptions::kMaxListenerShards,
+      config.GetInt(GRPC_ARG_TCP_LISTENER_SHARDS));
+  if (options.listener_shards == 0) {
+    options.listener_shards =
+        std::min(static_cast<int>(gpr_cpu_num_cores()),
+                 PosixTcpOptions::kMaxListenerShards);
+  }
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -571,6 +597,27 @@ absl::Status PosixSocketWrapper::SetSocketDscp(int dscp) {
   return absl::OkStatus();
 }
 
+void PosixSocketWrapper::TrySetSocketBusyPoll(int busy_poll_us) {
+  if (busy_poll_us <= 0) {
+    return;
+  }
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                      sizeof(busy_poll_us))) {
+    VLOG(2) << "setsockopt(SO_BUSY_POLL): " << grpc_core::StrError(errno);
+    return;
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  const int prefer_busy_poll = 1;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll,
+                      sizeof(prefer_busy_poll))) {
+    VLOG(2) << "setsockopt(SO_PREFER_BUSY_POLL): "
+            << grpc_core::StrError(errno);
+  }
+#endif
+#endif
+}
+
 #if GPR_LINUX == 1
 // For Linux, it will be detected to support TCP_USER_TIMEOUT
 #ifndef TCP_USER_TIMEOUT
@@ -867,6 +914,10 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   grpc_core::Crash("unimplemented");
 }
 
+void PosixSocketWrapper::TrySetSocketBusyPoll(int /*busy_poll_us*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketNoSigpipeIfPossible() {
   grpc_core::Crash("unimplemented");
 }
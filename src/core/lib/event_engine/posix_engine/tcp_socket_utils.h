@@ -56,21 +56,38 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kZerocpRxEnabledDefault = 0;
+  static constexpr int kDefaultRecvBytesThreshold = 128 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kDefaultListenerShards = 1;
+  static constexpr int kMaxListenerShards = 64;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
   int tcp_tx_zerocopy_send_bytes_threshold = kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
+  // Size SO_RCVBUF after the transport's BDP estimate, unless
+  // tcp_receive_buffer_size is set.
+  bool tcp_receive_buffer_from_bdp = false;
+  // The caller guarantees its read callbacks do not block, so the poller may
+  // run read completions inline.
+  bool inline_read_callbacks = false;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_rx_zero_copy_enabled = kZerocpRxEnabledDefault;
+  int tcp_rx_zerocopy_recv_bytes_threshold = kDefaultRecvBytesThreshold;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   int dscp = kDscpNotSet;
+  // Number of SO_REUSEPORT listening sockets opened for each bound address.
+  int listener_shards = kDefaultListenerShards;
+  // SO_BUSY_POLL value in microseconds for created sockets. 0 leaves the
+  // system default in place.
+  int busy_poll_us = 0;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   grpc_event_engine::experimental::MemoryAllocatorFactory*
@@ -136,12 +153,20 @@ struct PosixTcpOptions {
         other.tcp_tx_zerocopy_send_bytes_threshold;
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
+    tcp_receive_buffer_size = other.tcp_receive_buffer_size;
+    tcp_receive_buffer_from_bdp = other.tcp_receive_buffer_from_bdp;
+    inline_read_callbacks = other.inline_read_callbacks;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
+    tcp_rx_zerocopy_recv_bytes_threshold =
+        other.tcp_rx_zerocopy_recv_bytes_threshold;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    listener_shards = other.listener_shards;
+    busy_poll_us = other.busy_poll_us;
   }
 };
 
@@ -196,6 +221,11 @@ class PosixSocketWrapper {
   void TrySetSocketTcpUserTimeout(const PosixTcpOptions& options,
                                   bool is_client);
 
+  // Tries to set SO_BUSY_POLL and SO_PREFER_BUSY_POLL, where the system
+  // headers define them, if busy_poll_us is positive. Failures are logged and
+  // otherwise ignored.
+  void TrySetSocketBusyPoll(int busy_poll_us);
+
   // Tries to set SO_NOSIGPIPE if available on this platform.
   // If SO_NO_SIGPIPE is not available, returns not OK status.
   absl::Status SetSocketNoSigpipeIfPossible();
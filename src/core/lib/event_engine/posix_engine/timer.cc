@@ -26,6 +26,8 @@
 #include <limits>
 #include <utility>
 
+#include "absl/log/check.h"
+#include "absl/numeric/bits.h"
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
 #include "src/core/util/time.h"
 #include "src/core/util/useful.h"
@@ -305,4 +307,230 @@ TimerList::TimerCheck(grpc_core::Timestamp* next) {
   return std::move(run);
 }
 
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      num_shards_(grpc_core::Clamp(2 * gpr_cpu_num_cores(), 1u, 32u)),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()),
+      shards_(new Shard[num_shards_]) {
+  const int64_t now = min_timer_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < num_shards_; i++) {
+    grpc_core::MutexLock lock(&shards_[i].mu);
+    shards_[i].current = now;
+  }
+}
+
+size_t TimerWheel::Shard::SlotFor(int64_t deadline) const {
+  if (deadline < current) return kDueSlot;
+  for (int level = 0; level < kLevels; level++) {
+    const int shift = kSlotBits * (level + 1);
+    if ((deadline >> shift) == (current >> shift)) {
+      return level * kSlots +
+             ((deadline >> (kSlotBits * level)) & (kSlots - 1));
+    }
+  }
+  return kOverflowSlot;
+}
+
+void TimerWheel::Shard::Link(Timer* timer, size_t slot) {
+  timer->heap_index = slot;
+  timer->prev = nullptr;
+  timer->next = slots[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  slots[slot] = timer;
+  if (slot < kOverflowSlot) {
+    occupied[slot / kSlots] |= uint64_t{1} << (slot % kSlots);
+  }
+}
+
+void TimerWheel::Shard::Unlink(Timer* timer) {
+  const size_t slot = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    slots[slot] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (slot < kOverflowSlot && slots[slot] == nullptr) {
+    occupied[slot / kSlots] &= ~(uint64_t{1} << (slot % kSlots));
+  }
+}
+
+Timer* TimerWheel::Shard::TakeSlot(size_t slot) {
+  Timer* head = slots[slot];
+  slots[slot] = nullptr;
+  if (slot < kOverflowSlot) {
+    occupied[slot / kSlots] &= ~(uint64_t{1} << (slot % kSlots));
+  }
+  return head;
+}
+
+int64_t TimerWheel::Shard::NextDeadlineLowerBound() const {
+  int64_t min_deadline = std::numeric_limits<int64_t>::max();
+  for (Timer* timer = slots[kDueSlot]; timer != nullptr; timer = timer->next) {
+    min_deadline = std::min(min_deadline, timer->deadline);
+  }
+  if (min_deadline != std::numeric_limits<int64_t>::max()) return min_deadline;
+  // Level 0 slots hold the timers of a single tick, and the slots behind the
+  // current one are empty.
+  const int digit = static_cast<int>(current & (kSlots - 1));
+  const uint64_t ahead = occupied[0] & (~uint64_t{0} << digit);
+  if (ahead != 0) {
+    return (current & ~static_cast<int64_t>(kSlots - 1)) |
+           absl::countr_zero(ahead);
+  }
+  // Higher levels: only the slots after the current one may be occupied, and
+  // the earliest possible deadline of a slot is its start.
+  for (int level = 1; level < kLevels; level++) {
+    const int shift = kSlotBits * level;
+    const int level_digit = static_cast<int>((current >> shift) & (kSlots - 1));
+    const uint64_t level_ahead =
+        occupied[level] & ~((uint64_t{2} << level_digit) - 1);
+    if (level_ahead != 0) {
+      return ((current >> (shift + kSlotBits)) << (shift + kSlotBits)) |
+             (static_cast<int64_t>(absl::countr_zero(level_ahead)) << shift);
+    }
+  }
+  if (slots[kOverflowSlot] != nullptr) {
+    const int shift = kSlotBits * kLevels;
+    return ((current >> shift) + 1) << shift;
+  }
+  return std::numeric_limits<int64_t>::max();
+}
+
+void TimerWheel::Shard::AdvanceTo(int64_t tick) {
+  const int64_t previous = current;
+  current = tick;
+  auto reinsert = [this](Timer* timer) {
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      Link(timer, SlotFor(timer->deadline));
+      timer = next;
+    }
+  };
+  if ((tick >> (kSlotBits * kLevels)) != (previous >> (kSlotBits * kLevels))) {
+    reinsert(TakeSlot(kOverflowSlot));
+  }
+  // Cascade from the top so that timers moved down from a level are moved
+  // further down by the levels below it if needed.
+  for (int level = kLevels - 1; level > 0; level--) {
+    const int shift = kSlotBits * level;
+    if ((tick >> shift) == (previous >> shift)) continue;
+    reinsert(TakeSlot(level * kSlots + ((tick >> shift) & (kSlots - 1))));
+  }
+}
+
+void TimerWheel::Shard::PopTimers(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  auto pop_all = [out](Timer* timer) {
+    while (timer != nullptr) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+      timer = timer->next;
+    }
+  };
+  pop_all(TakeSlot(kDueSlot));
+  // Keep now + 1 representable.
+  now = std::min(now, std::numeric_limits<int64_t>::max() - 1);
+  while (current <= now) {
+    Timer* expired = TakeSlot(current & (kSlots - 1));
+    for (Timer* timer = expired; timer != nullptr; timer = timer->next) {
+      DCHECK_EQ(timer->deadline, current);
+    }
+    pop_all(expired);
+    AdvanceTo(std::min(NextDeadlineLowerBound(), now + 1));
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  timer->closure = closure;
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  bool lowered_min_deadline = false;
+  int64_t deadline_ms;
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    timer->pending = true;
+    grpc_core::Timestamp now = host_->Now();
+    if (deadline <= now) {
+      deadline = now;
+    }
+    deadline_ms = deadline.milliseconds_after_process_epoch();
+    timer->deadline = deadline_ms;
+    shard->Link(timer, shard->SlotFor(deadline_ms));
+    if (deadline_ms < shard->min_deadline) {
+      shard->min_deadline = deadline_ms;
+      lowered_min_deadline = true;
+    }
+  }
+
+  // As in TimerList::TimerInit, a TimerCheck may run between the two critical
+  // sections: at worst it fires the timer early and we kick for nothing.
+  if (lowered_min_deadline) {
+    grpc_core::MutexLock lock(&mu_);
+    if (deadline_ms < min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(deadline_ms, std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard* shard = &shards_[grpc_core::HashPointer(timer, num_shards_)];
+  grpc_core::MutexLock lock(&shard->mu);
+
+  if (timer->pending) {
+    timer->pending = false;
+    shard->Unlink(timer);
+    return true;
+  }
+
+  return false;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  grpc_core::Timestamp now = host_->Now();
+  grpc_core::Timestamp min_timer =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+          min_timer_.load(std::memory_order_relaxed));
+
+  if (now < min_timer) {
+    if (next != nullptr) {
+      *next = std::min(*next, min_timer);
+    }
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> done;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    const int64_t now_ms = now.milliseconds_after_process_epoch();
+    int64_t new_min_timer = std::numeric_limits<int64_t>::max();
+    for (size_t i = 0; i < num_shards_; i++) {
+      Shard& shard = shards_[i];
+      grpc_core::MutexLock shard_lock(&shard.mu);
+      if (shard.min_deadline <= now_ms) {
+        shard.PopTimers(now_ms, &done);
+        shard.min_deadline = shard.NextDeadlineLowerBound();
+      }
+      new_min_timer = std::min(new_min_timer, shard.min_deadline);
+    }
+    min_timer_.store(new_min_timer, std::memory_order_relaxed);
+    if (next != nullptr) {
+      *next = std::min(
+          *next,
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(new_min_timer));
+    }
+  }
+  checker_mu_.Unlock();
+
+  return std::move(done);
+}
+
 }  // namespace grpc_event_engine::experimental
@@ -25,6 +25,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -39,7 +40,8 @@ namespace grpc_event_engine::experimental {
 
 struct Timer {
   int64_t deadline;
-  // kInvalidHeapIndex if not in heap.
+  // TimerList: kInvalidHeapIndex if not in heap.
+  // TimerWheel: index of the slot holding the timer.
   size_t heap_index;
   bool pending;
   struct Timer* next;
@@ -66,26 +68,23 @@ class TimerListHost {
   ~TimerListHost() = default;
 };
 
-class TimerList {
+class TimerListInterface {
  public:
-  explicit TimerList(TimerListHost* host);
-
-  TimerList(const TimerList&) = delete;
-  TimerList& operator=(const TimerList&) = delete;
+  virtual ~TimerListInterface() = default;
 
   // Initialize a Timer.
   // When expired, the closure will be run. If the timer is canceled, the
   // closure will not be run. Behavior is undefined for a deadline of
   // grpc_core::Timestamp::InfFuture().
-  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
-                 experimental::EventEngine::Closure* closure);
+  virtual void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                         experimental::EventEngine::Closure* closure) = 0;
 
   // Cancel a Timer.
   // Returns false if the timer cannot be canceled. This will happen if the
   // timer has already fired, or if its closure is currently running. The
   // closure is guaranteed to run eventually if this method returns false.
   // Otherwise, this returns true, and the closure will not be run.
-  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer);
+  GRPC_MUST_USE_RESULT virtual bool TimerCancel(Timer* timer) = 0;
 
   // Check for timers to be run, and return them.
   // Return nullopt if timers could not be checked due to contention with
@@ -96,8 +95,22 @@ class TimerList {
   // *next is never guaranteed to be updated on any given execution; however,
   // with high probability at least one thread in the system will see an update
   // at any time slice.
+  virtual std::optional<std::vector<experimental::EventEngine::Closure*>>
+  TimerCheck(grpc_core::Timestamp* next) = 0;
+};
+
+class TimerList final : public TimerListInterface {
+ public:
+  explicit TimerList(TimerListHost* host);
+
+  TimerList(const TimerList&) = delete;
+  TimerList& operator=(const TimerList&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
   std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
-      grpc_core::Timestamp* next);
+      grpc_core::Timestamp* next) override;
 
  private:
   // A "timer shard". Contains a 'heap' and a 'list' of timers. All timers with
@@ -157,6 +170,80 @@ class TimerList {
   const std::unique_ptr<Shard*[]> shard_queue_ ABSL_GUARDED_BY(mu_);
 };
 
+// A timer list backed by hierarchical timing wheels.
+//
+// Like in TimerList, timers are spread over shards by address. Each shard has
+// kLevels wheels of kSlots slots, where a slot of level l spans kSlots^l
+// milliseconds. A timer is linked into the slot of the lowest level whose
+// current revolution contains its deadline, and is moved down to a lower level
+// when the wheel reaches its slot. Timers too far in the future for the top
+// level wait in an overflow list. Adding and cancelling a timer are O(1), and
+// since most timers are cancelled well before their deadline, most of them are
+// never moved at all.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kSlotBits = 6;
+  static constexpr size_t kSlots = size_t{1} << kSlotBits;
+  static constexpr int kLevels = 4;
+  // Timers beyond the range of the top level.
+  static constexpr size_t kOverflowSlot = kLevels * kSlots;
+  // Timers whose deadline had already passed when they were added.
+  static constexpr size_t kDueSlot = kOverflowSlot + 1;
+  static constexpr size_t kNumSlots = kDueSlot + 1;
+
+  struct Shard {
+    // Returns the slot a timer with the given deadline belongs to.
+    size_t SlotFor(int64_t deadline) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Link(Timer* timer, size_t slot) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Unlink(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Unlinks and returns all the timers of a slot.
+    Timer* TakeSlot(size_t slot) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns a time no later than the earliest deadline in this shard, or
+    // INT64_MAX if the shard is empty.
+    int64_t NextDeadlineLowerBound() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Moves the wheel forward to tick, cascading the timers whose slot was
+    // reached down to lower levels. There must be no timer in the wheel with a
+    // deadline earlier than tick.
+    void AdvanceTo(int64_t tick) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void PopTimers(int64_t now,
+                   std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // Every tick before this one has been processed.
+    int64_t current ABSL_GUARDED_BY(mu) = 0;
+    // The lower bound of the deadlines in this shard that TimerWheel::min_timer_
+    // was last computed from, or lowered to.
+    int64_t min_deadline ABSL_GUARDED_BY(mu) =
+        std::numeric_limits<int64_t>::max();
+    // Heads of the doubly linked, nullptr terminated, timer lists of each slot.
+    Timer* slots[kNumSlots] ABSL_GUARDED_BY(mu) = {};
+    // Bitmap of the non-empty slots of each level.
+    uint64_t occupied[kLevels] ABSL_GUARDED_BY(mu) = {};
+  };
+
+  TimerListHost* const host_;
+  const size_t num_shards_;
+  grpc_core::Mutex mu_;
+  // A lower bound of the next deadline across all shards.
+  std::atomic<int64_t> min_timer_;
+  // Allow only one TimerCheck at once.
+  grpc_core::Mutex checker_mu_;
+  const std::unique_ptr<Shard[]> shards_;
+};
+
 }  // namespace grpc_event_engine::experimental
 
 #endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_H
@@ -16,6 +16,7 @@
 
 #include <memory>
 
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
@@ -35,7 +36,13 @@ class ThreadPoolForkCallbackMethods {
 }  // namespace
 
 std::shared_ptr<ThreadPool> MakeThreadPool(size_t reserve_threads) {
-  auto thread_pool = std::make_shared<WorkStealingThreadPool>(reserve_threads);
+  WorkStealingThreadPool::Options options;
+  options.thread_affinity =
+      grpc_core::ConfigVars::Get().EventEngineThreadAffinity();
+  options.sharded_global_queue =
+      grpc_core::ConfigVars::Get().EventEngineShardedWorkQueue();
+  auto thread_pool =
+      std::make_shared<WorkStealingThreadPool>(reserve_threads, options);
   g_thread_pool_fork_manager->RegisterForkable(
       thread_pool, ThreadPoolForkCallbackMethods::Prefork,
       ThreadPoolForkCallbackMethods::PostforkParent,
@@ -24,9 +24,11 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <map>
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
@@ -37,8 +39,10 @@
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/sharded_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/util/backoff.h"
+#include "src/core/util/cpu_topology.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
 #include "src/core/util/examine_stack.h"
@@ -162,6 +166,18 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+// Groups the CPUs the process may run on by NUMA node.
+std::vector<std::vector<unsigned>> CpusByNumaNode() {
+  std::map<int, std::vector<unsigned>> nodes;
+  for (const grpc_core::CpuInfo& info : grpc_core::GetCpuTopology()) {
+    nodes[info.numa_node].push_back(info.cpu);
+  }
+  std::vector<std::vector<unsigned>> cpus;
+  cpus.reserve(nodes.size());
+  for (auto& node : nodes) cpus.push_back(std::move(node.second));
+  return cpus;
+}
+
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
@@ -169,7 +185,12 @@ thread_local WorkQueue* g_local_queue = nullptr;
 // -------- WorkStealingThreadPool --------
 
 WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+    : WorkStealingThreadPool(reserve_threads, Options()) {}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               const Options& options)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads,
+                                                         options)} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -193,22 +214,29 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
 
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t numa_node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+  if (numa_node >= queues_.size()) queues_.resize(numa_node + 1);
+  queues_[numa_node].emplace(queue);
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t numa_node) {
   grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+  queues_[numa_node].erase(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    size_t numa_node) {
   grpc_core::MutexLock lock(&mu_);
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
-    if (closure != nullptr) return closure;
+  // Start with the thief's own node, then go through the other nodes in turn.
+  for (size_t i = 0; i < queues_.size(); i++) {
+    for (auto* queue : queues_[(numa_node + i) % queues_.size()]) {
+      closure = queue->PopMostRecent();
+      if (closure != nullptr) return closure;
+    }
   }
   return nullptr;
 }
@@ -222,8 +250,14 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, const Options& options)
+    : reserve_threads_(reserve_threads),
+      queue_(options.sharded_global_queue
+                 ? std::unique_ptr<WorkQueue>(
+                       std::make_unique<ShardedWorkQueue>(this))
+                 : std::make_unique<BasicWorkQueue>(this)) {
+  if (options.thread_affinity) numa_node_cpus_ = CpusByNumaNode();
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -239,7 +273,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
-    queue_.Add(closure);
+    queue_->Add(closure);
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
@@ -262,6 +296,19 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
       .Start();
 }
 
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::PinCurrentThread() {
+  if (numa_node_cpus_.empty()) return 0;
+  size_t node = next_numa_node_.fetch_add(1, std::memory_order_relaxed) %
+                numa_node_cpus_.size();
+  // If pinning fails, the thread still prefers stealing from the node it was
+  // assigned to, which is harmless.
+  if (!grpc_core::SetCurrentThreadAffinity(numa_node_cpus_[node])) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "WorkStealingThreadPool could not pin thread to NUMA node " << node;
+  }
+  return node;
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   SetShutdown(true);
   // Wait until all threads have exited.
@@ -277,7 +324,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  CHECK(queue_.Empty());
+  CHECK(queue_->Empty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -430,7 +477,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->queue_->Empty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -481,8 +528,9 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
+  numa_node_ = pool_->PinCurrentThread();
   g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  pool_->theft_registry()->Enroll(g_local_queue, numa_node_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -501,7 +549,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry()->Unenroll(g_local_queue, numa_node_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -543,7 +591,7 @@ bool WorkStealingThreadPool::ThreadState::Step() {
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->theft_registry()->StealOne(numa_node_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
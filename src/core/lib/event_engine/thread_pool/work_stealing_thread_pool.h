@@ -26,13 +26,13 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/any_invocable.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
-#include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/notification.h"
@@ -43,7 +43,17 @@ namespace grpc_event_engine::experimental {
 
 class WorkStealingThreadPool final : public ThreadPool {
  public:
+  struct Options {
+    // Pin worker threads to the CPUs of a NUMA node, and have them steal work
+    // from the threads of the same node first.
+    bool thread_affinity = false;
+    // Use a ShardedWorkQueue rather than a BasicWorkQueue for the work that is
+    // not run from a worker thread.
+    bool sharded_global_queue = false;
+  };
+
   explicit WorkStealingThreadPool(size_t reserve_threads);
+  WorkStealingThreadPool(size_t reserve_threads, const Options& options);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -78,20 +88,21 @@ class WorkStealingThreadPool final : public ThreadPool {
   //
   // Every worker thread registers and unregisters its thread-local thread pool
   // here, and steals closures from other threads when work is otherwise
-  // unavailable.
+  // unavailable. Queues are grouped by the NUMA node of their thread, and
+  // thieves look at the queues of their own node first.
   class TheftRegistry {
    public:
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Enroll(WorkQueue* queue, size_t numa_node) ABSL_LOCKS_EXCLUDED(mu_);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t numa_node) ABSL_LOCKS_EXCLUDED(mu_);
     // Returns one closure from another thread, or nullptr if none are
     // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    EventEngine::Closure* StealOne(size_t numa_node) ABSL_LOCKS_EXCLUDED(mu_);
 
    private:
     grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    std::vector<absl::flat_hash_set<WorkQueue*>> queues_ ABSL_GUARDED_BY(mu_);
   };
 
   // An implementation of the ThreadPool
@@ -101,7 +112,7 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads, const Options& options);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
@@ -112,6 +123,10 @@ class WorkStealingThreadPool final : public ThreadPool {
     // threads created to populate the initial pool are not rate-limited, but
     // all others thread creation scenarios are rate-limited.
     void StartThread();
+    // Pins the calling thread to the CPUs of a NUMA node, going through the
+    // nodes in turn, and returns the index of that node. Returns 0 if thread
+    // affinity is disabled.
+    size_t PinCurrentThread();
     // Shut down the pool, and wait for all threads to exit.
     // This method is safe to call from within a ThreadPool thread.
     void Quiesce();
@@ -140,7 +155,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
-    WorkQueue* queue() { return &queue_; }
+    WorkQueue* queue() { return queue_.get(); }
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -171,10 +186,13 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    // The CPUs of each NUMA node, empty if thread affinity is disabled.
+    std::vector<std::vector<unsigned>> numa_node_cpus_;
+    std::atomic<size_t> next_numa_node_{0};
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    const std::unique_ptr<WorkQueue> queue_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -214,6 +232,7 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    size_t numa_node_ = 0;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
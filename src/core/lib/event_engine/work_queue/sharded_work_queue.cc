@@ -0,0 +1,79 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/sharded_work_queue.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <utility>
+
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+ShardedWorkQueue::ShardedWorkQueue(void* owner) : owner_(owner) {}
+
+bool ShardedWorkQueue::Empty() const {
+  return size_.load(std::memory_order_relaxed) == 0;
+}
+
+size_t ShardedWorkQueue::Size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+template <typename PopFn>
+EventEngine::Closure* ShardedWorkQueue::PopFromShards(PopFn pop) {
+  if (Empty()) return nullptr;
+  Shard* const begin = shards_.begin();
+  const size_t num_shards = shards_.end() - begin;
+  const size_t local = &shards_.this_cpu() - begin;
+  for (size_t i = 0; i < num_shards; i++) {
+    Shard& shard = begin[(local + i) % num_shards];
+    grpc_core::MutexLock lock(&shard.mu);
+    if (shard.q.empty()) continue;
+    EventEngine::Closure* closure = pop(shard.q);
+    size_.fetch_sub(1, std::memory_order_relaxed);
+    return closure;
+  }
+  return nullptr;
+}
+
+EventEngine::Closure* ShardedWorkQueue::PopMostRecent() {
+  return PopFromShards([](std::deque<EventEngine::Closure*>& q) {
+    auto tmp = q.back();
+    q.pop_back();
+    return tmp;
+  });
+}
+
+EventEngine::Closure* ShardedWorkQueue::PopOldest() {
+  return PopFromShards([](std::deque<EventEngine::Closure*>& q) {
+    auto tmp = q.front();
+    q.pop_front();
+    return tmp;
+  });
+}
+
+void ShardedWorkQueue::Add(EventEngine::Closure* closure) {
+  Shard& shard = shards_.this_cpu();
+  grpc_core::MutexLock lock(&shard.mu);
+  shard.q.push_back(closure);
+  size_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ShardedWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,80 @@
+// Copyright 2025 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_SHARDED_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_SHARDED_WORK_QUEUE_H
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <atomic>
+#include <deque>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_event_engine::experimental {
+
+// A WorkQueue split into per-CPU shards, each guarded by its own mutex.
+//
+// Closures are added to the shard of the CPU the caller runs on, and popped
+// from that shard first, so that producers and consumers running on different
+// CPUs do not contend on a single lock. When the local shard is empty, the
+// other shards are searched in turn.
+//
+// LIFO and FIFO ordering only hold among the closures of a single shard.
+class ShardedWorkQueue : public WorkQueue {
+ public:
+  ShardedWorkQueue() : owner_(nullptr) {}
+  explicit ShardedWorkQueue(void* owner);
+  // Returns whether the queue is empty
+  bool Empty() const override;
+  // Returns the size of the queue.
+  size_t Size() const override;
+  // Returns the most recent element of the local shard, or of the first
+  // non-empty shard after it. Returns nullptr if the queue is empty.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element of the local shard, or of the first non-empty
+  // shard after it. Returns nullptr if the queue is empty.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    grpc_core::Mutex mu;
+    std::deque<EventEngine::Closure*> q ABSL_GUARDED_BY(mu);
+  };
+
+  // Pops from each shard in turn, starting from the local one, until pop
+  // returns a closure.
+  template <typename PopFn>
+  EventEngine::Closure* PopFromShards(PopFn pop);
+
+  grpc_core::PerCpu<Shard> shards_{
+      grpc_core::PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+  // Total number of closures in all shards. It is updated while holding the
+  // lock of the shard that changed, so it never undercounts a shard.
+  std::atomic<size_t> size_{0};
+  const void* const owner_ = nullptr;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_SHARDED_WORK_QUEUE_H
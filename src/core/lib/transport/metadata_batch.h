@@ -45,7 +45,6 @@
 #include "src/core/lib/transport/parsed_metadata.h"
 #include "src/core/lib/transport/simple_slice_based_metadata.h"
 #include "src/core/util/chunked_vector.h"
-#include "src/core/util/if_list.h"
 #include "src/core/util/packed_table.h"
 #include "src/core/util/time.h"
 #include "src/core/util/type_list.h"
@@ -626,24 +625,85 @@ struct EncodableTraits<void> {
   using List = Typelist<>;
 };
 
-template <typename Trait>
-struct EncodableNameLookupKeyComparison {
-  bool operator()(absl::string_view key) { return key == Trait::key(); }
+// Maps keys to the index of the trait they name in Traits, with a small open
+// addressing hash table: classifying a key costs a hash and usually a single
+// string comparison, rather than a comparison against the key of every trait.
+template <typename... Traits>
+class EncodableNameIndex {
+ public:
+  static constexpr uint8_t kNotFound = 255;
+
+  static uint8_t Find(absl::string_view key) {
+    static const EncodableNameIndex index;
+    return index.FindInTable(key);
+  }
+
+ private:
+  static constexpr size_t kNumTraits = sizeof...(Traits);
+  static_assert(kNumTraits < kNotFound, "Too many traits to index");
+  // At most a quarter full, to keep probe sequences short.
+  static constexpr size_t kTableSize = [] {
+    size_t size = 16;
+    while (size < 4 * kNumTraits) size *= 2;
+    return size;
+  }();
+
+  // Keys of traits mostly differ by their length and last bytes (many share
+  // prefixes such as "grpc-").
+  static size_t Hash(absl::string_view key) {
+    uint32_t h = static_cast<uint32_t>(key.size());
+    if (!key.empty()) {
+      h = h * 31 + static_cast<uint8_t>(key[key.size() - 1]);
+      h = h * 31 + static_cast<uint8_t>(key[key.size() / 2]);
+    }
+    return (h * 0x9e3779b1u) >> 16 & (kTableSize - 1);
+  }
+
+  EncodableNameIndex() : keys_{Traits::key()...} {
+    for (uint8_t& slot : slots_) slot = kNotFound;
+    for (size_t i = 0; i < kNumTraits; ++i) {
+      size_t slot = Hash(keys_[i]);
+      while (slots_[slot] != kNotFound) slot = (slot + 1) & (kTableSize - 1);
+      slots_[slot] = static_cast<uint8_t>(i);
+    }
+  }
+
+  uint8_t FindInTable(absl::string_view key) const {
+    for (size_t slot = Hash(key);; slot = (slot + 1) & (kTableSize - 1)) {
+      const uint8_t index = slots_[slot];
+      if (index == kNotFound || keys_[index] == key) return index;
+    }
+  }
+
+  absl::string_view keys_[kNumTraits];
+  uint8_t slots_[kTableSize];
 };
 
 template <typename Trait, typename Op>
 struct EncodableNameLookupOnFound {
-  auto operator()(Op* op) { return op->Found(Trait()); }
+  static auto Found(Op* op) { return op->Found(Trait()); }
 };
 
 template <typename... Traits>
 struct EncodableNameLookup {
   template <typename Op>
   static auto Lookup(absl::string_view key, Op* op) {
-    return IfList(
-        key, op, [key](Op* op) { return op->NotFound(key); },
-        EncodableNameLookupKeyComparison<Traits>()...,
-        EncodableNameLookupOnFound<Traits, Op>()...);
+    using Result = decltype(op->NotFound(key));
+    static constexpr Result (*kFound[])(Op*) = {
+        &EncodableNameLookupOnFound<Traits, Op>::Found...};
+    const uint8_t index = EncodableNameIndex<Traits...>::Find(key);
+    if (index == EncodableNameIndex<Traits...>::kNotFound) {
+      return op->NotFound(key);
+    }
+    return kFound[index](op);
+  }
+};
+
+template <>
+struct EncodableNameLookup<> {
+  template <typename Op>
+  static auto Lookup(absl::string_view key, Op* op) {
+    return op->NotFound(key);
   }
 };
 
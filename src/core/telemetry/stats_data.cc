@@ -136,6 +136,7 @@ const absl::string_view
         "tcp_read_alloc_64k",
         "http2_settings_writes",
         "http2_pings_sent",
+        "http2_bdp_pings_sent",
         "http2_writes_begun",
         "http2_transport_stalls",
         "http2_stream_stalls",
@@ -158,6 +159,8 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "poller_spin_hits",
+        "poller_spin_misses",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -177,6 +180,7 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of 64k allocations by the TCP subsystem for reading",
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
+    "Number of HTTP2 pings sent to estimate the bandwidth delay product",
     "Number of HTTP2 writes initiated",
     "Number of times sending was completely stalled by the transport flow "
     "control window",
@@ -204,6 +208,8 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of times a spinning poller found events before going to sleep",
+    "Number of times a spinning poller found no events and went to sleep",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -226,6 +232,9 @@ const absl::string_view
         "http2_transport_remote_window_update",
         "http2_transport_window_update_period",
         "http2_stream_window_update_period",
+        "http2_transport_stall_duration_ms",
+        "http2_stream_stall_duration_ms",
+        "http2_bdp_estimate",
         "wrr_subchannel_list_size",
         "wrr_subchannel_ready_size",
         "work_serializer_run_time_ms",
@@ -269,6 +278,9 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Transport window update sent by peer",
     "Period in milliseconds at which peer sends transport window update",
     "Period in milliseconds at which peer sends stream window update",
+    "Milliseconds for which sending was stalled by the transport window",
+    "Milliseconds for which sending was stalled by a stream window",
+    "Bandwidth delay product estimated by each HTTP2 BDP ping, in bytes",
     "Number of subchannels in a subchannel list at picker creation time",
     "Number of READY subchannels in a subchannel list at picker creation time",
     "Number of milliseconds work serializers run for",
@@ -499,6 +511,7 @@ GlobalStats::GlobalStats()
       tcp_read_alloc_64k{0},
       http2_settings_writes{0},
       http2_pings_sent{0},
+      http2_bdp_pings_sent{0},
       http2_writes_begun{0},
       http2_transport_stalls{0},
       http2_stream_stalls{0},
@@ -520,7 +533,9 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      poller_spin_hits{0},
+      poller_spin_misses{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -583,6 +598,15 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2StreamWindowUpdatePeriod:
       return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
                            http2_stream_window_update_period.buckets()};
+    case Histogram::kHttp2TransportStallDurationMs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           http2_transport_stall_duration_ms.buckets()};
+    case Histogram::kHttp2StreamStallDurationMs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           http2_stream_stall_duration_ms.buckets()};
+    case Histogram::kHttp2BdpEstimate:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
+                           http2_bdp_estimate.buckets()};
     case Histogram::kWrrSubchannelListSize:
       return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
                            wrr_subchannel_list_size.buckets()};
@@ -677,6 +701,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.http2_settings_writes.load(std::memory_order_relaxed);
     result->http2_pings_sent +=
         data.http2_pings_sent.load(std::memory_order_relaxed);
+    result->http2_bdp_pings_sent +=
+        data.http2_bdp_pings_sent.load(std::memory_order_relaxed);
     result->http2_writes_begun +=
         data.http2_writes_begun.load(std::memory_order_relaxed);
     result->http2_transport_stalls +=
@@ -717,6 +743,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->poller_spin_hits +=
+        data.poller_spin_hits.load(std::memory_order_relaxed);
+    result->poller_spin_misses +=
+        data.poller_spin_misses.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
@@ -744,6 +774,11 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->http2_transport_window_update_period);
     data.http2_stream_window_update_period.Collect(
         &result->http2_stream_window_update_period);
+    data.http2_transport_stall_duration_ms.Collect(
+        &result->http2_transport_stall_duration_ms);
+    data.http2_stream_stall_duration_ms.Collect(
+        &result->http2_stream_stall_duration_ms);
+    data.http2_bdp_estimate.Collect(&result->http2_bdp_estimate);
     data.wrr_subchannel_list_size.Collect(&result->wrr_subchannel_list_size);
     data.wrr_subchannel_ready_size.Collect(&result->wrr_subchannel_ready_size);
     data.work_serializer_run_time_ms.Collect(
@@ -810,6 +845,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_settings_writes =
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
+  result->http2_bdp_pings_sent =
+      http2_bdp_pings_sent - other.http2_bdp_pings_sent;
   result->http2_writes_begun = http2_writes_begun - other.http2_writes_begun;
   result->http2_transport_stalls =
       http2_transport_stalls - other.http2_transport_stalls;
@@ -837,6 +874,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->poller_spin_hits = poller_spin_hits - other.poller_spin_hits;
+  result->poller_spin_misses = poller_spin_misses - other.poller_spin_misses;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -874,6 +913,12 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_stream_window_update_period =
       http2_stream_window_update_period -
       other.http2_stream_window_update_period;
+  result->http2_transport_stall_duration_ms =
+      http2_transport_stall_duration_ms -
+      other.http2_transport_stall_duration_ms;
+  result->http2_stream_stall_duration_ms =
+      http2_stream_stall_duration_ms - other.http2_stream_stall_duration_ms;
+  result->http2_bdp_estimate = http2_bdp_estimate - other.http2_bdp_estimate;
   result->wrr_subchannel_list_size =
       wrr_subchannel_list_size - other.wrr_subchannel_list_size;
   result->wrr_subchannel_ready_size =
@@ -213,6 +213,7 @@ struct GlobalStats {
     kTcpReadAlloc64k,
     kHttp2SettingsWrites,
     kHttp2PingsSent,
+    kHttp2BdpPingsSent,
     kHttp2WritesBegun,
     kHttp2TransportStalls,
     kHttp2StreamStalls,
@@ -235,6 +236,8 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kPollerSpinHits,
+    kPollerSpinMisses,
     COUNT
   };
   enum class Histogram {
@@ -257,6 +260,9 @@ struct GlobalStats {
     kHttp2TransportRemoteWindowUpdate,
     kHttp2TransportWindowUpdatePeriod,
     kHttp2StreamWindowUpdatePeriod,
+    kHttp2TransportStallDurationMs,
+    kHttp2StreamStallDurationMs,
+    kHttp2BdpEstimate,
     kWrrSubchannelListSize,
     kWrrSubchannelReadySize,
     kWorkSerializerRunTimeMs,
@@ -303,6 +309,7 @@ struct GlobalStats {
       uint64_t tcp_read_alloc_64k;
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
+      uint64_t http2_bdp_pings_sent;
       uint64_t http2_writes_begun;
       uint64_t http2_transport_stalls;
       uint64_t http2_stream_stalls;
@@ -325,6 +332,8 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t poller_spin_hits;
+      uint64_t poller_spin_misses;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -347,6 +356,9 @@ struct GlobalStats {
   Histogram_16777216_20 http2_transport_remote_window_update;
   Histogram_100000_20 http2_transport_window_update_period;
   Histogram_100000_20 http2_stream_window_update_period;
+  Histogram_100000_20 http2_transport_stall_duration_ms;
+  Histogram_100000_20 http2_stream_stall_duration_ms;
+  Histogram_16777216_20 http2_bdp_estimate;
   Histogram_10000_20 wrr_subchannel_list_size;
   Histogram_10000_20 wrr_subchannel_ready_size;
   Histogram_100000_20 work_serializer_run_time_ms;
@@ -426,6 +438,10 @@ class GlobalStatsCollector {
   void IncrementHttp2PingsSent() {
     data_.this_cpu().http2_pings_sent.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementHttp2BdpPingsSent() {
+    data_.this_cpu().http2_bdp_pings_sent.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementHttp2WritesBegun() {
     data_.this_cpu().http2_writes_begun.fetch_add(1, std::memory_order_relaxed);
   }
@@ -499,6 +515,13 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementPollerSpinHits() {
+    data_.this_cpu().poller_spin_hits.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementPollerSpinMisses() {
+    data_.this_cpu().poller_spin_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -557,6 +580,15 @@ class GlobalStatsCollector {
   void IncrementHttp2StreamWindowUpdatePeriod(int value) {
     data_.this_cpu().http2_stream_window_update_period.Increment(value);
   }
+  void IncrementHttp2TransportStallDurationMs(int value) {
+    data_.this_cpu().http2_transport_stall_duration_ms.Increment(value);
+  }
+  void IncrementHttp2StreamStallDurationMs(int value) {
+    data_.this_cpu().http2_stream_stall_duration_ms.Increment(value);
+  }
+  void IncrementHttp2BdpEstimate(int value) {
+    data_.this_cpu().http2_bdp_estimate.Increment(value);
+  }
   void IncrementWrrSubchannelListSize(int value) {
     data_.this_cpu().wrr_subchannel_list_size.Increment(value);
   }
@@ -636,6 +668,7 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
+    std::atomic<uint64_t> http2_bdp_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
     std::atomic<uint64_t> http2_transport_stalls{0};
     std::atomic<uint64_t> http2_stream_stalls{0};
@@ -658,6 +691,8 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> poller_spin_hits{0};
+    std::atomic<uint64_t> poller_spin_misses{0};
     HistogramCollector_65536_26 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
@@ -677,6 +712,9 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20 http2_transport_remote_window_update;
     HistogramCollector_100000_20 http2_transport_window_update_period;
     HistogramCollector_100000_20 http2_stream_window_update_period;
+    HistogramCollector_100000_20 http2_transport_stall_duration_ms;
+    HistogramCollector_100000_20 http2_stream_stall_duration_ms;
+    HistogramCollector_16777216_20 http2_bdp_estimate;
     HistogramCollector_10000_20 wrr_subchannel_list_size;
     HistogramCollector_10000_20 wrr_subchannel_ready_size;
     HistogramCollector_100000_20 work_serializer_run_time_ms;
@@ -0,0 +1,42 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_CPU_TOPOLOGY_H
+#define GRPC_SRC_CORE_UTIL_CPU_TOPOLOGY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <vector>
+
+namespace grpc_core {
+
+struct CpuInfo {
+  unsigned cpu;
+  // NUMA node the CPU belongs to, 0 if unknown.
+  int numa_node;
+};
+
+// Returns the CPUs the calling process is allowed to run on, in increasing
+// order, along with their NUMA node. Returns an empty vector if the topology
+// is not available on this platform.
+std::vector<CpuInfo> GetCpuTopology();
+
+// Restricts the calling thread to the given CPUs.
+// Returns false if the affinity could not be set, or if this is not supported
+// on this platform.
+bool SetCurrentThreadAffinity(const std::vector<unsigned>& cpus);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_CPU_TOPOLOGY_H
@@ -23,6 +23,10 @@
 
 #include <sys/sysctl.h>
 
+#include <vector>
+
+#include "src/core/util/cpu_topology.h"
+
 unsigned gpr_cpu_num_cores(void) {
   size_t len;
   unsigned int ncpu;
@@ -40,4 +44,14 @@ unsigned gpr_cpu_num_cores(void) {
 // and some code might be relying on it.
 unsigned gpr_cpu_current_cpu(void) { return 0; }
 
+namespace grpc_core {
+
+std::vector<CpuInfo> GetCpuTopology() { return {}; }
+
+bool SetCurrentThreadAffinity(const std::vector<unsigned>& /*cpus*/) {
+  return false;
+}
+
+}  // namespace grpc_core
+
 #endif  // GPR_CPU_IPHONE
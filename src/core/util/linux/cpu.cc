@@ -24,14 +24,23 @@
 
 #ifdef GPR_CPU_LINUX
 
+#include <dirent.h>
 #include <errno.h>
 #include <grpc/support/cpu.h>
 #include <grpc/support/sync.h>
+#include <pthread.h>
 #include <sched.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
+#include <string>
+#include <vector>
+
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/cpu_topology.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/strerror.h"
 
@@ -83,4 +92,58 @@ unsigned gpr_cpu_current_cpu(void) {
 #endif
 }
 
+namespace grpc_core {
+
+namespace {
+// Sysfs links every CPU to its NUMA node with a cpuN/nodeM entry.
+int NumaNodeOfCpu(unsigned cpu) {
+  std::string path = absl::StrCat("/sys/devices/system/cpu/cpu", cpu);
+  DIR* dir = opendir(path.c_str());
+  if (dir == nullptr) return 0;
+  int node = 0;
+  while (struct dirent* entry = readdir(dir)) {
+    if (strncmp(entry->d_name, "node", 4) == 0 &&
+        absl::SimpleAtoi(entry->d_name + 4, &node)) {
+      break;
+    }
+    node = 0;
+  }
+  closedir(dir);
+  return node;
+}
+}  // namespace
+
+std::vector<CpuInfo> GetCpuTopology() {
+  std::vector<CpuInfo> topology;
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    LOG(ERROR) << "Error determining CPU affinity: "
+               << grpc_core::StrError(errno);
+    return topology;
+  }
+  for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed)) {
+      topology.push_back(CpuInfo{cpu, NumaNodeOfCpu(cpu)});
+    }
+  }
+  return topology;
+}
+
+bool SetCurrentThreadAffinity(const std::vector<unsigned>& cpus) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (unsigned cpu : cpus) {
+    if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  if (err != 0) {
+    VLOG(2) << "Cannot set thread affinity: " << grpc_core::StrError(err);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace grpc_core
+
 #endif  // GPR_CPU_LINUX
@@ -27,7 +27,10 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "absl/log/log.h"
+#include "src/core/util/cpu_topology.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/useful.h"
 
@@ -80,4 +83,14 @@ unsigned gpr_cpu_current_cpu(void) {
   return (unsigned)grpc_core::HashPointer(thread_id, gpr_cpu_num_cores());
 }
 
+namespace grpc_core {
+
+std::vector<CpuInfo> GetCpuTopology() { return {}; }
+
+bool SetCurrentThreadAffinity(const std::vector<unsigned>& /*cpus*/) {
+  return false;
+}
+
+}  // namespace grpc_core
+
 #endif  // GPR_CPU_POSIX
@@ -21,6 +21,9 @@
 #ifdef GPR_WINDOWS
 #include <grpc/support/cpu.h>
 
+#include <vector>
+
+#include "src/core/util/cpu_topology.h"
 #include "src/core/util/crash.h"
 
 unsigned gpr_cpu_num_cores(void) {
@@ -31,4 +34,14 @@ unsigned gpr_cpu_num_cores(void) {
 
 unsigned gpr_cpu_current_cpu(void) { return GetCurrentProcessorNumber(); }
 
+namespace grpc_core {
+
+std::vector<CpuInfo> GetCpuTopology() { return {}; }
+
+bool SetCurrentThreadAffinity(const std::vector<unsigned>& /*cpus*/) {
+  return false;
+}
+
+}  // namespace grpc_core
+
 #endif  // GPR_WINDOWS
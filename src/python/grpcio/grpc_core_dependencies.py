@@ -91,6 +91,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/ping_rate_policy.cc',
     'src/core/ext/transport/chttp2/transport/stream_lists.cc',
     'src/core/ext/transport/chttp2/transport/varint.cc',
+    'src/core/ext/transport/chttp2/transport/write_scheduler.cc',
     'src/core/ext/transport/chttp2/transport/write_size_policy.cc',
     'src/core/ext/transport/chttp2/transport/writing.cc',
     'src/core/ext/transport/inproc/inproc_transport.cc',
@@ -450,11 +451,14 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
     'src/core/lib/event_engine/posix_engine/lockfree_event.cc',
     'src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc',
+    'src/core/lib/event_engine/posix_engine/poller_inline_scheduler.cc',
+    'src/core/lib/event_engine/posix_engine/poller_write_queue.cc',
     'src/core/lib/event_engine/posix_engine/posix_endpoint.cc',
     'src/core/lib/event_engine/posix_engine/posix_engine.cc',
     'src/core/lib/event_engine/posix_engine/posix_engine_listener.cc',
@@ -487,6 +491,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/sharded_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/iomgr/buffer_list.cc',
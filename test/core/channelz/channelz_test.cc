@@ -577,6 +577,21 @@ TEST(ChannelzServerTest, BasicServerAPIFunctionality) {
   ValidateServer(channelz_server, {3, 3, 3});
 }
 
+TEST(ChannelzSocketTest, FlowControlWindows) {
+  ExecCtx exec_ctx;
+  auto socket = MakeRefCounted<SocketNode>(
+      "ipv4:127.0.0.1:1234", "ipv4:127.0.0.1:5678", "test_socket", nullptr);
+  Json json = socket->RenderJson();
+  const Json::Object& data = json.object().at("data").object();
+  EXPECT_EQ(data.count("localFlowControlWindow"), 0u);
+  EXPECT_EQ(data.count("remoteFlowControlWindow"), 0u);
+  socket->RecordFlowControlWindows(-100, 65535);
+  json = socket->RenderJson();
+  const Json::Object& updated_data = json.object().at("data").object();
+  EXPECT_EQ(updated_data.at("localFlowControlWindow").string(), "-100");
+  EXPECT_EQ(updated_data.at("remoteFlowControlWindow").string(), "65535");
+}
+
 TEST_F(ChannelzRegistryBasedTest, BasicGetServersTest) {
   ExecCtx exec_ctx;
   ServerFixture server;
@@ -21,6 +21,7 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -55,10 +56,16 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
+#include "src/core/lib/event_engine/posix_engine/poller_inline_scheduler.h"
+#include "src/core/lib/event_engine/posix_engine/poller_write_queue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/notification.h"
@@ -518,6 +525,233 @@ TEST_F(EventPollerTest, TestEventPollerHandleChange) {
   close(sv[1]);
 }
 
+// Test that the io_uring poller reports readiness of registered fds and that
+// orphaned handles can be reused. Skipped if the running kernel does not
+// support io_uring.
+TEST_F(EventPollerTest, TestIoUringPollerHandle) {
+  auto poller = MakeIoUringPoller(Scheduler());
+  if (poller == nullptr) {
+    GTEST_SKIP() << "io_uring poller is not supported";
+  }
+  for (int i = 0; i < 2; i++) {
+    int sv[2];
+    EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    int flags = fcntl(sv[0], F_GETFL, 0);
+    EXPECT_EQ(fcntl(sv[0], F_SETFL, flags | O_NONBLOCK), 0);
+    EventHandle* handle =
+        poller->CreateHandle(sv[0], "TestIoUringPollerHandle", false);
+    EXPECT_NE(handle, nullptr);
+    grpc_core::Notification readable;
+    handle->NotifyOnRead(
+        PosixEngineClosure::TestOnlyToClosure([&readable](absl::Status status) {
+          EXPECT_TRUE(status.ok());
+          readable.Notify();
+        }));
+    char data = 0;
+    EXPECT_EQ(write(sv[1], &data, 1), 1);
+    // The read closure runs on the event engine, so poll with a short timeout
+    // until it has been notified.
+    while (!readable.HasBeenNotified()) {
+      poller->Work(100ms, []() {});
+    }
+    EXPECT_EQ(read(sv[0], &data, 1), 1);
+    grpc_core::Notification orphaned;
+    handle->OrphanHandle(
+        PosixEngineClosure::TestOnlyToClosure(
+            [&orphaned](absl::Status /*status*/) { orphaned.Notify(); }),
+        nullptr, "done");
+    orphaned.WaitForNotification();
+    close(sv[1]);
+  }
+  poller->Kick();
+  EXPECT_EQ(poller->Work(24h, []() {}), Poller::WorkResult::kKicked);
+  poller->Shutdown();
+}
+
+// Test that the io_uring poller waits no longer than the timeout it is given,
+// and that it stops polling its ring, which a forked child shares with its
+// parent, once PostforkChild has run.
+TEST_F(EventPollerTest, TestIoUringPollerTimeoutAndPostforkChild) {
+  auto poller = MakeIoUringPoller(Scheduler());
+  if (poller == nullptr) {
+    GTEST_SKIP() << "io_uring poller is not supported";
+  }
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller->Work(50ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, 50ms);
+  EXPECT_LT(elapsed, 5s);
+  poller->PrepareFork();
+  poller->PostforkChild();
+  EXPECT_EQ(poller->Work(24h, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  poller->Shutdown();
+}
+
+TEST_F(EventPollerTest, TestEpoll1PollerSpin) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.poller_spin_us = 1000;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  auto poller = MakeEpoll1Poller(Scheduler());
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+  if (poller == nullptr) {
+    GTEST_SKIP() << "epoll1 poller is not supported";
+  }
+  auto before = grpc_core::global_stats().Collect();
+  // Nothing to find: the poller spins, gives up and then times out.
+  EXPECT_EQ(poller->Work(10ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+  // A pending kick is picked up while spinning.
+  poller->Kick();
+  EXPECT_EQ(poller->Work(24h, []() {}), Poller::WorkResult::kKicked);
+  auto diff = grpc_core::global_stats().Collect()->Diff(*before);
+  EXPECT_GE(diff->poller_spin_misses, 1);
+  EXPECT_GE(diff->poller_spin_hits, 1);
+  poller->Shutdown();
+}
+
+TEST_F(EventPollerTest, TestEpoll1PollerSpinDecaysToZero) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.poller_spin_us = 1000;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  auto poller = MakeEpoll1Poller(Scheduler());
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+  if (poller == nullptr) {
+    GTEST_SKIP() << "epoll1 poller is not supported";
+  }
+  // Every empty spin halves the window, which runs out after 10 of them.
+  for (int i = 0; i < 16; i++) {
+    EXPECT_EQ(poller->Work(1ms, []() {}),
+              Poller::WorkResult::kDeadlineExceeded);
+  }
+  auto before = grpc_core::global_stats().Collect();
+  EXPECT_EQ(poller->Work(1ms, []() {}), Poller::WorkResult::kDeadlineExceeded);
+  auto diff = grpc_core::global_stats().Collect()->Diff(*before);
+  EXPECT_EQ(diff->poller_spin_misses, 0);
+  EXPECT_EQ(diff->poller_spin_hits, 0);
+  // An event found right after going to sleep reopens the window.
+  poller->Kick();
+  EXPECT_EQ(poller->Work(24h, []() {}), Poller::WorkResult::kKicked);
+  before = grpc_core::global_stats().Collect();
+  EXPECT_EQ(poller->Work(1ms, []() {}), Poller::WorkResult::kDeadlineExceeded);
+  diff = grpc_core::global_stats().Collect()->Diff(*before);
+  EXPECT_EQ(diff->poller_spin_misses, 1);
+  poller->Shutdown();
+}
+
+// Runs everything it is given inline and counts how many times it was asked to
+// schedule something.
+class CountingScheduler : public Scheduler {
+ public:
+  void Run(EventEngine::Closure* closure) override {
+    ++scheduled_closures;
+    closure->Run();
+  }
+  void Run(absl::AnyInvocable<void()> cb) override {
+    ++scheduled_callbacks;
+    cb();
+  }
+  int scheduled_closures = 0;
+  int scheduled_callbacks = 0;
+};
+
+TEST(PollerWriteQueueTest, BatchesClosuresReadyInTheSamePass) {
+  CountingScheduler scheduler;
+  PollerWriteQueue queue(&scheduler, 4);
+  int runs = 0;
+  AnyInvocableClosure closure([&runs]() { ++runs; });
+  {
+    PollerWriteQueue::Batch batch(&queue);
+    for (int i = 0; i < 10; ++i) {
+      queue.Run(&closure);
+    }
+    EXPECT_EQ(runs, 0);
+  }
+  // 10 closures are flushed by 3 callbacks of at most 4 closures each.
+  EXPECT_EQ(runs, 10);
+  EXPECT_EQ(scheduler.scheduled_callbacks, 3);
+  EXPECT_EQ(scheduler.scheduled_closures, 0);
+  // Outside of a batch, closures are scheduled right away.
+  queue.Run(&closure);
+  EXPECT_EQ(runs, 11);
+  EXPECT_EQ(scheduler.scheduled_closures, 1);
+}
+
+TEST(PollerWriteQueueTest, DisabledQueueDoesNotBatch) {
+  CountingScheduler scheduler;
+  PollerWriteQueue queue(&scheduler, 0);
+  int runs = 0;
+  AnyInvocableClosure closure([&runs]() { ++runs; });
+  {
+    PollerWriteQueue::Batch batch(&queue);
+    queue.Run(&closure);
+    queue.Run(&closure);
+    EXPECT_EQ(runs, 2);
+  }
+  EXPECT_EQ(scheduler.scheduled_closures, 2);
+  EXPECT_EQ(scheduler.scheduled_callbacks, 0);
+}
+
+TEST(PollerInlineSchedulerTest, RunsNonBlockingClosuresAtTheEndOfThePass) {
+  CountingScheduler scheduler;
+  PollerInlineScheduler inline_scheduler(&scheduler,
+                                         std::chrono::seconds(10));
+  int runs = 0;
+  AnyInvocableClosure closure([&runs]() { ++runs; });
+  {
+    PollerInlineScheduler::Pass pass(&inline_scheduler);
+    for (int i = 0; i < 10; ++i) {
+      inline_scheduler.RunNonBlocking(&closure);
+    }
+    EXPECT_EQ(runs, 0);
+    // Closures that may block are scheduled right away.
+    inline_scheduler.Run(&closure);
+    EXPECT_EQ(runs, 1);
+  }
+  EXPECT_EQ(runs, 11);
+  EXPECT_EQ(scheduler.scheduled_closures, 1);
+  // Outside of a pass, closures are scheduled right away.
+  inline_scheduler.RunNonBlocking(&closure);
+  EXPECT_EQ(runs, 12);
+  EXPECT_EQ(scheduler.scheduled_closures, 2);
+}
+
+TEST(PollerInlineSchedulerTest, SchedulesClosuresLeftOnceBudgetIsSpent) {
+  CountingScheduler scheduler;
+  PollerInlineScheduler inline_scheduler(&scheduler,
+                                         std::chrono::microseconds(1));
+  int runs = 0;
+  AnyInvocableClosure closure([&runs]() {
+    ++runs;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  });
+  {
+    PollerInlineScheduler::Pass pass(&inline_scheduler);
+    for (int i = 0; i < 5; ++i) {
+      inline_scheduler.RunNonBlocking(&closure);
+    }
+  }
+  // The first closure exhausts the budget, the others are scheduled.
+  EXPECT_EQ(runs, 5);
+  EXPECT_EQ(scheduler.scheduled_closures, 4);
+}
+
+TEST(PollerInlineSchedulerTest, DisabledSchedulerDoesNotRunInline) {
+  CountingScheduler scheduler;
+  PollerInlineScheduler inline_scheduler(&scheduler,
+                                         std::chrono::microseconds(0));
+  int runs = 0;
+  AnyInvocableClosure closure([&runs]() { ++runs; });
+  {
+    PollerInlineScheduler::Pass pass(&inline_scheduler);
+    inline_scheduler.RunNonBlocking(&closure);
+    inline_scheduler.RunNonBlocking(&closure);
+    EXPECT_EQ(runs, 2);
+  }
+  EXPECT_EQ(scheduler.scheduled_closures, 2);
+}
+
 std::atomic<int> kTotalActiveWakeupFdHandles{0};
 
 // A helper class representing one file descriptor. Its implemented using
@@ -20,6 +20,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
 #include <list>
 #include <memory>
 #include <string>
@@ -33,6 +36,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/config/config_vars.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -54,6 +58,14 @@
 #include "test/core/event_engine/test_suite/posix/oracle_event_engine_posix.h"
 #include "test/core/test_util/port.h"
 
+#include <sys/socket.h>
+#include <unistd.h>
+
+#ifdef GRPC_LINUX_ERRQUEUE
+#include <errno.h>
+#include <sys/mman.h>
+#endif
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -67,6 +79,8 @@ constexpr int kMinMessageSize = 1024;
 constexpr int kNumConnections = 10;
 constexpr int kNumExchangedMessages = 100;
 std::atomic<int> g_num_active_connections{0};
+// Whether this thread is inside a Worker's call to PosixEventPoller::Work.
+thread_local bool g_in_poller_work = false;
 
 struct Connection {
   std::unique_ptr<EventEngine::Endpoint> client_endpoint;
@@ -76,7 +90,8 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    grpc_core::ChannelArgs args = grpc_core::ChannelArgs()) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>("bar");
   std::string target_addr = absl::StrCat(
@@ -93,13 +108,15 @@ std::list<Connection> CreateConnectedEndpoints(
         server_endpoint = std::move(ep);
         server_signal->Notify();
       };
-  grpc_core::ChannelArgs args;
   auto quota = grpc_core::ResourceQuota::Default();
   args = args.Set(GRPC_ARG_RESOURCE_QUOTA, quota);
   if (is_zero_copy_enabled) {
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, 1);
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
+    args = args.Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, 1);
+    args = args.SetIfUnset(GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD,
+                           kMinMessageSize);
   }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
@@ -142,6 +159,96 @@ std::list<Connection> CreateConnectedEndpoints(
   return connections;
 }
 
+// Writes `data` on `send_endpoint` and returns the slices read for it on
+// `receive_endpoint`, as they were read.
+SliceBuffer WriteAndReadAll(absl::string_view data,
+                            EventEngine::Endpoint* send_endpoint,
+                            EventEngine::Endpoint* receive_endpoint) {
+  SliceBuffer write_buffer;
+  AppendStringToSliceBuffer(&write_buffer, data);
+  grpc_core::Notification write_signal;
+  if (send_endpoint->Write(
+          [&write_signal](absl::Status status) {
+            CHECK_OK(status);
+            write_signal.Notify();
+          },
+          &write_buffer, nullptr)) {
+    write_signal.Notify();
+  }
+  SliceBuffer received;
+  while (received.Length() < data.size()) {
+    SliceBuffer read_buffer;
+    EventEngine::Endpoint::ReadArgs args = {
+        static_cast<int64_t>(data.size() - received.Length())};
+    grpc_core::Notification read_signal;
+    if (receive_endpoint->Read(
+            [&read_signal](absl::Status status) {
+              CHECK_OK(status);
+              read_signal.Notify();
+            },
+            &read_buffer, &args)) {
+      read_signal.Notify();
+    }
+    read_signal.WaitForNotification();
+    read_buffer.MoveFirstNBytesIntoSliceBuffer(read_buffer.Length(), received);
+  }
+  write_signal.WaitForNotification();
+  return received;
+}
+
+// The SO_RCVBUF the kernel reports for a TCP socket after it was asked for
+// `size` bytes.
+int KernelRcvBufFor(int size) {
+  int fd = socket(AF_INET6, SOCK_STREAM, 0);
+  CHECK_GE(fd, 0);
+  CHECK_EQ(setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)), 0);
+  int rcvbuf = 0;
+  socklen_t len = sizeof(rcvbuf);
+  CHECK_EQ(getsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, &len), 0);
+  close(fd);
+  return rcvbuf;
+}
+
+int RcvBuf(EventEngine::Endpoint* endpoint) {
+  int rcvbuf = 0;
+  socklen_t len = sizeof(rcvbuf);
+  CHECK_EQ(getsockopt(static_cast<PosixEndpoint*>(endpoint)->GetWrappedFd(),
+                      SOL_SOCKET, SO_RCVBUF, &rcvbuf, &len),
+           0);
+  return rcvbuf;
+}
+
+#ifdef GRPC_LINUX_ERRQUEUE
+// Whether `p` points into a read-only shared mapping, which is how the pages
+// received with TCP_ZEROCOPY_RECEIVE are mapped.
+bool IsInReadOnlySharedMapping(const void* p) {
+  const uintptr_t address = reinterpret_cast<uintptr_t>(p);
+  std::ifstream maps("/proc/self/maps");
+  std::string line;
+  while (std::getline(maps, line)) {
+    uintptr_t start;
+    uintptr_t end;
+    char perms[5];
+    if (sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR " %4s", &start, &end,
+               perms) != 3) {
+      continue;
+    }
+    if (address >= start && address < end) {
+      return absl::string_view(perms) == "r--s";
+    }
+  }
+  return false;
+}
+
+class MockMemoryAllocatorImpl : public internal::MemoryAllocatorImpl {
+ public:
+  MOCK_METHOD(size_t, Reserve, (MemoryRequest));
+  MOCK_METHOD(grpc_slice, MakeSlice, (MemoryRequest));
+  MOCK_METHOD(void, Release, (size_t));
+  MOCK_METHOD(void, Shutdown, ());
+};
+#endif  // GRPC_LINUX_ERRQUEUE
+
 }  // namespace
 
 std::string TestScenarioName(const ::testing::TestParamInfo<bool>& info) {
@@ -171,12 +278,14 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
 
  private:
   void Work() {
+    g_in_poller_work = true;
     auto result = poller_->Work(24h, [this]() {
       // Schedule next work instantiation immediately and take a Ref for
       // the next instantiation.
       Ref().release();
       engine_->Run([this]() { Work(); });
     });
+    g_in_poller_work = false;
     ASSERT_TRUE(result == Poller::WorkResult::kOk ||
                 result == Poller::WorkResult::kKicked);
     // Corresponds to the Ref taken for the current instantiation. If the
@@ -193,6 +302,7 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
 };
 
 class PosixEndpointTest : public ::testing::TestWithParam<bool> {
+ protected:
   void SetUp() override {
     oracle_ee_ = std::make_shared<PosixOracleEventEngine>();
     scheduler_ =
@@ -325,9 +435,226 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
+// SO_RCVBUF follows twice the BDP estimate, within [64KB, 32MB], and only
+// changes of at least 2x are applied.
+TEST_P(PosixEndpointTest, ReceiveBufferFollowsBdpEstimate) {
+  if (PosixPoller() == nullptr || GetParam()) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        grpc_core::ChannelArgs().Set(GRPC_ARG_TCP_RECEIVE_BUFFER_FROM_BDP, 1));
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    auto* endpoint = static_cast<PosixEndpoint*>(client_endpoint.get());
+    // The estimate is applied by the next read.
+    auto apply_estimate = [&](int64_t bdp) {
+      endpoint->SetBdpEstimate(bdp);
+      ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                      server_endpoint.get(), endpoint)
+                      .ok());
+    };
+    apply_estimate(100 * 1024);
+    EXPECT_EQ(RcvBuf(endpoint), KernelRcvBufFor(200 * 1024));
+    apply_estimate(1024 * 1024 * 1024);
+    EXPECT_EQ(RcvBuf(endpoint), KernelRcvBufFor(32 * 1024 * 1024));
+    apply_estimate(1024);
+    EXPECT_EQ(RcvBuf(endpoint), KernelRcvBufFor(64 * 1024));
+    apply_estimate(48 * 1024);
+    EXPECT_EQ(RcvBuf(endpoint), KernelRcvBufFor(64 * 1024));
+  }
+  worker->Wait();
+}
+
+// With a BDP estimate, reads are sized up to the estimate right away, but no
+// further than the configured max read chunk size.
+TEST_P(PosixEndpointTest, ReadTargetGrowsToBdpEstimateWithinMaxChunkSize) {
+  if (PosixPoller() == nullptr || GetParam()) {
+    return;
+  }
+  constexpr int kMaxReadChunkSize = 256 * 1024;
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        grpc_core::ChannelArgs().Set(GRPC_ARG_TCP_MAX_READ_CHUNK_SIZE,
+                                     kMaxReadChunkSize));
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    auto* endpoint = static_cast<PosixEndpoint*>(client_endpoint.get());
+    EXPECT_EQ(endpoint->TestOnlyReadTargetLength(),
+              PosixTcpOptions::kDefaultReadChunkSize);
+    endpoint->SetBdpEstimate(1024 * 1024);
+    const std::string payload(4 * kMaxReadChunkSize, 'x');
+    SliceBuffer received =
+        WriteAndReadAll(payload, server_endpoint.get(), endpoint);
+    EXPECT_EQ(ExtractSliceBufferIntoString(&received), payload);
+    // A read that fills its buffer grows the target to the capped estimate,
+    // from which it only decays by 1% per read that does not.
+    EXPECT_LE(endpoint->TestOnlyReadTargetLength(), kMaxReadChunkSize);
+    EXPECT_GT(endpoint->TestOnlyReadTargetLength(), kMaxReadChunkSize / 2);
+  }
+  worker->Wait();
+}
+
+#ifdef GRPC_LINUX_ERRQUEUE
+// Reads below the rx zerocopy threshold are copied out of the socket, even
+// with rx zerocopy enabled.
+TEST_P(PosixEndpointTest, ReadsBelowRxZerocopyThresholdAreCopied) {
+  if (PosixPoller() == nullptr || !GetParam()) {
+    return;
+  }
+  constexpr int kRxZerocopyThreshold = 1024 * 1024;
+  constexpr size_t kPayloadSize = 64 * 1024;
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        grpc_core::ChannelArgs().Set(
+            GRPC_ARG_TCP_RX_ZEROCOPY_RECV_BYTES_THRESHOLD, kRxZerocopyThreshold));
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    const std::string payload(kPayloadSize, 'x');
+    SliceBuffer received =
+        WriteAndReadAll(payload, server_endpoint.get(), client_endpoint.get());
+    for (size_t i = 0; i < received.Count(); ++i) {
+      EXPECT_FALSE(IsInReadOnlySharedMapping(received[i].begin()));
+    }
+    EXPECT_EQ(ExtractSliceBufferIntoString(&received), payload);
+  }
+  worker->Wait();
+}
+
+// The pages of a zerocopy receive are charged to the allocator until the slice
+// that owns them is destroyed.
+TEST(PosixEndpointZerocopyReceiveTest, ReceivedPagesAreChargedUntilReleased) {
+  const size_t length = 4 * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  void* pages = mmap(nullptr, length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS,
+                     -1, 0);
+  ASSERT_NE(pages, MAP_FAILED);
+  auto allocator_impl =
+      std::make_shared<::testing::StrictMock<MockMemoryAllocatorImpl>>();
+  MemoryAllocator allocator(allocator_impl);
+  EXPECT_CALL(*allocator_impl, Reserve(MemoryRequest(length)))
+      .WillOnce(::testing::Return(length));
+  Slice slice = MakeZerocopyReceivedSlice(pages, length, allocator);
+  ::testing::Mock::VerifyAndClearExpectations(allocator_impl.get());
+  EXPECT_EQ(slice.data(), pages);
+  EXPECT_EQ(slice.length(), length);
+  // References to the slice share the charge of the original.
+  Slice ref = slice.Ref();
+  slice = Slice();
+  ::testing::Mock::VerifyAndClearExpectations(allocator_impl.get());
+  EXPECT_EQ(msync(pages, length, MS_ASYNC), 0);
+  EXPECT_CALL(*allocator_impl, Release(length));
+  ref = Slice();
+  ::testing::Mock::VerifyAndClearExpectations(allocator_impl.get());
+  // Releasing the slice unmapped the pages.
+  EXPECT_EQ(msync(pages, length, MS_ASYNC), -1);
+  EXPECT_EQ(errno, ENOMEM);
+  EXPECT_CALL(*allocator_impl, Shutdown());
+}
+#endif  // GRPC_LINUX_ERRQUEUE
+
+// Runs the tests on a poller that may run non-blocking read callbacks inline.
+class PosixEndpointInlineReadTest : public PosixEndpointTest {
+ protected:
+  void SetUp() override {
+    grpc_core::ConfigVars::Overrides overrides;
+    overrides.poller_inline_budget_us = 1000000;
+    grpc_core::ConfigVars::SetOverrides(overrides);
+    PosixEndpointTest::SetUp();
+    grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+  }
+};
+
+// With GRPC_ARG_TCP_INLINE_READ_CALLBACKS set, pollers that have an inline
+// budget run the endpoint's read callbacks on the polling thread, and the data
+// read is unaffected.
+TEST_P(PosixEndpointInlineReadTest, ReadCallbacksRunOnPollerThread) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  const bool runs_reads_inline = PosixPoller()->Name() == "epoll1" ||
+                                 PosixPoller()->Name() == "io_uring";
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        grpc_core::ChannelArgs().Set(GRPC_ARG_TCP_INLINE_READ_CALLBACKS, 1));
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    int inline_reads = 0;
+    for (int i = 0; i < kNumExchangedMessages; ++i) {
+      const std::string message = GetNextSendMessage();
+      // Start the read before anything is sent, so that it has to wait for
+      // the poller.
+      SliceBuffer received;
+      EventEngine::Endpoint::ReadArgs args = {
+          static_cast<int64_t>(message.size())};
+      grpc_core::Notification read_signal;
+      bool read_inline = false;
+      if (client_endpoint->Read(
+              [&read_signal, &read_inline](absl::Status status) {
+                CHECK_OK(status);
+                read_inline = g_in_poller_work;
+                read_signal.Notify();
+              },
+              &received, &args)) {
+        read_signal.Notify();
+      }
+      SliceBuffer write_buffer;
+      AppendStringToSliceBuffer(&write_buffer, message);
+      grpc_core::Notification write_signal;
+      if (server_endpoint->Write(
+              [&write_signal](absl::Status status) {
+                CHECK_OK(status);
+                write_signal.Notify();
+              },
+              &write_buffer, nullptr)) {
+        write_signal.Notify();
+      }
+      read_signal.WaitForNotification();
+      write_signal.WaitForNotification();
+      if (read_inline) ++inline_reads;
+      while (received.Length() < message.size()) {
+        SliceBuffer more;
+        EventEngine::Endpoint::ReadArgs more_args = {
+            static_cast<int64_t>(message.size() - received.Length())};
+        grpc_core::Notification more_signal;
+        if (client_endpoint->Read(
+                [&more_signal](absl::Status status) {
+                  CHECK_OK(status);
+                  more_signal.Notify();
+                },
+                &more, &more_args)) {
+          more_signal.Notify();
+        }
+        more_signal.WaitForNotification();
+        more.MoveFirstNBytesIntoSliceBuffer(more.Length(), received);
+      }
+      EXPECT_EQ(ExtractSliceBufferIntoString(&received), message);
+    }
+    if (runs_reads_inline) {
+      EXPECT_GT(inline_reads, 0);
+    } else {
+      EXPECT_EQ(inline_reads, 0);
+    }
+  }
+  worker->Wait();
+}
+
 // Test with zero copy enabled and disabled.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
+INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointInlineReadTest,
+                         ::testing::ValuesIn({false, true}), &TestScenarioName);
 
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -96,6 +96,29 @@ TEST(PosixEngineListenerUtils, ListenerContainerAddWildcardAddressesTest) {
   }
 }
 
+TEST(PosixEngineListenerUtils, ListenerContainerAppendSocketShardsTest) {
+  TestListenerSocketsContainer listener_sockets;
+  PosixTcpOptions options;
+  options.allow_reuse_port = true;
+  options.listener_shards = 4;
+  auto addr = URIToResolvedAddress("ipv4:127.0.0.1:0");
+  ASSERT_TRUE(addr.ok());
+  auto socket = CreateAndPrepareListenerSocket(options, *addr);
+  ASSERT_TRUE(socket.ok()) << socket.status();
+  ListenerContainerAppendSocket(listener_sockets, options, *socket);
+  if (PosixSocketWrapper::IsSocketReusePortSupported()) {
+    EXPECT_EQ(listener_sockets.Size(), options.listener_shards);
+  } else {
+    EXPECT_EQ(listener_sockets.Size(), 1);
+  }
+  // Every shard listens on the port picked for the first socket.
+  for (auto shard = listener_sockets.begin(); shard != listener_sockets.end();
+       ++shard) {
+    EXPECT_EQ(shard->port, socket->port);
+    close(shard->sock.Fd());
+  }
+}
+
 #ifdef GRPC_HAVE_IFADDRS
 TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
   TestListenerSocketsContainer listener_sockets;
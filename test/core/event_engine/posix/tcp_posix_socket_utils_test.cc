@@ -17,6 +17,7 @@
 #include <unistd.h>
 
 #include <memory>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
@@ -27,10 +28,13 @@
 // This test won't work except with posix sockets enabled
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/alloc.h>
 #include <netinet/in.h>
 #include <netinet/ip.h>
 
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #include "src/core/lib/iomgr/socket_mutator.h"
 #include "src/core/util/useful.h"
@@ -169,6 +173,34 @@ TEST(TcpPosixSocketUtilsTest, SocketOptionsTest) {
   close(sock);
 }
 
+TEST(TcpPosixSocketUtilsTest, CopiesKeepReceiveBufferOptions) {
+  PosixTcpOptions options;
+  options.tcp_receive_buffer_size = 1024 * 1024;
+  options.tcp_receive_buffer_from_bdp = true;
+  PosixTcpOptions copy(options);
+  EXPECT_EQ(copy.tcp_receive_buffer_size, 1024 * 1024);
+  EXPECT_TRUE(copy.tcp_receive_buffer_from_bdp);
+  PosixTcpOptions assigned;
+  assigned = copy;
+  EXPECT_EQ(assigned.tcp_receive_buffer_size, 1024 * 1024);
+  EXPECT_TRUE(assigned.tcp_receive_buffer_from_bdp);
+  PosixTcpOptions moved(std::move(assigned));
+  EXPECT_EQ(moved.tcp_receive_buffer_size, 1024 * 1024);
+  EXPECT_TRUE(moved.tcp_receive_buffer_from_bdp);
+}
+
+TEST(TcpPosixSocketUtilsTest, InlineReadCallbacksAreOptIn) {
+  EXPECT_FALSE(TcpOptionsFromEndpointConfig(
+                   ChannelArgsEndpointConfig(grpc_core::ChannelArgs()))
+                   .inline_read_callbacks);
+  PosixTcpOptions options =
+      TcpOptionsFromEndpointConfig(ChannelArgsEndpointConfig(
+          grpc_core::ChannelArgs().Set(GRPC_ARG_TCP_INLINE_READ_CALLBACKS, 1)));
+  EXPECT_TRUE(options.inline_read_callbacks);
+  PosixTcpOptions copy(options);
+  EXPECT_TRUE(copy.inline_read_callbacks);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -64,9 +64,15 @@ CheckResult FinishCheck(
   return CheckResult::kTimersFired;
 }
 
+template <typename T>
+class TimerListTest : public ::testing::Test {};
+
+using TimerListTypes = ::testing::Types<TimerList, TimerWheel>;
+TYPED_TEST_SUITE(TimerListTest, TimerListTypes);
+
 }  // namespace
 
-TEST(TimerListTest, Add) {
+TYPED_TEST(TimerListTest, Add) {
   Timer timers[20];
   StrictMock<MockClosure> closures[20];
 
@@ -75,7 +81,7 @@ TEST(TimerListTest, Add) {
 
   StrictMock<MockHost> host;
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   // 10 ms timers.  will expire in the current epoch
   for (int i = 0; i < 10; i++) {
@@ -129,7 +135,7 @@ TEST(TimerListTest, Add) {
 }
 
 // Cleaning up a list with pending timers.
-TEST(TimerListTest, Destruction) {
+TYPED_TEST(TimerListTest, Destruction) {
   Timer timers[5];
   StrictMock<MockClosure> closures[5];
 
@@ -137,7 +143,7 @@ TEST(TimerListTest, Destruction) {
   EXPECT_CALL(host, Now())
       .WillOnce(
           Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   EXPECT_CALL(host, Now())
       .WillOnce(
@@ -195,7 +201,7 @@ TEST(TimerListTest, Destruction) {
 //      step 1) to `now+4`
 //  4) Shuts down the timer list
 // https://github.com/grpc/grpc/issues/15904
-TEST(TimerListTest, LongRunningServiceCleanup) {
+TYPED_TEST(TimerListTest, LongRunningServiceCleanup) {
   Timer timers[4];
   StrictMock<MockClosure> closures[4];
 
@@ -204,7 +210,7 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
 
   StrictMock<MockHost> host;
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
-  TimerList timer_list(&host);
+  TypeParam timer_list(&host);
 
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
   timer_list.TimerInit(&timers[0], kStart + k25Days, &closures[0]);
@@ -238,6 +244,84 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[3]));
 }
 
+// Timers far enough apart to be spread over every level of the wheel and its
+// overflow list fire at their deadline, and not before.
+TEST(TimerWheelTest, CascadesTimersDownTheLevels) {
+  const int64_t kDelays[] = {1, 63, 64, 65, 4095, 4096, 4097, 300000, 20000000};
+  constexpr size_t kNumTimers = sizeof(kDelays) / sizeof(kDelays[0]);
+  Timer timers[kNumTimers];
+  StrictMock<MockClosure> closures[kNumTimers];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TimerWheel timer_wheel(&host);
+  EXPECT_CALL(host, Kick()).Times(testing::AnyNumber());
+
+  for (size_t i = 0; i < kNumTimers; i++) {
+    EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+    timer_wheel.TimerInit(&timers[i],
+                          kStart + grpc_core::Duration::Milliseconds(kDelays[i]),
+                          &closures[i]);
+  }
+
+  for (size_t i = 0; i < kNumTimers; i++) {
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    EXPECT_CALL(host, Now())
+        .WillOnce(
+            Return(kStart + grpc_core::Duration::Milliseconds(kDelays[i] - 1)));
+    EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(&next)),
+              CheckResult::kCheckedAndEmpty);
+    EXPECT_LE(next, kStart + grpc_core::Duration::Milliseconds(kDelays[i]));
+    EXPECT_CALL(host, Now())
+        .WillOnce(
+            Return(kStart + grpc_core::Duration::Milliseconds(kDelays[i])));
+    EXPECT_CALL(closures[i], Run());
+    EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+              CheckResult::kTimersFired);
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+}
+
+// Timers cancelled after being cascaded to a lower level do not fire.
+TEST(TimerWheelTest, CancelAfterCascade) {
+  Timer timers[2];
+  StrictMock<MockClosure> closures[2];
+
+  const auto kStart = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0);
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  TimerWheel timer_wheel(&host);
+  EXPECT_CALL(host, Kick()).Times(testing::AnyNumber());
+
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  timer_wheel.TimerInit(&timers[0],
+                        kStart + grpc_core::Duration::Milliseconds(5000),
+                        &closures[0]);
+  EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
+  timer_wheel.TimerInit(&timers[1],
+                        kStart + grpc_core::Duration::Milliseconds(5010),
+                        &closures[1]);
+
+  // Moves both timers down to level 0.
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(4999)));
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+  EXPECT_TRUE(timer_wheel.TimerCancel(&timers[0]));
+
+  EXPECT_CALL(host, Now())
+      .WillOnce(Return(kStart + grpc_core::Duration::Milliseconds(5010)));
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_wheel.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_wheel.TimerCancel(&timers[1]));
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -16,11 +16,13 @@
 #include <grpc/grpc.h>
 #include <grpc/support/thd_id.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <thread>
 #include <tuple>
@@ -31,11 +33,16 @@
 #include "gtest/gtest.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/util/cpu_topology.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
 
+#ifdef GPR_LINUX
+#include <sched.h>
+#endif
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -289,6 +296,87 @@ TYPED_TEST(ThreadPoolTest, WorkerThreadLocalRunWorksWithOtherPools) {
   p1.Quiesce();
 }
 
+#ifdef GPR_LINUX
+// Returns the CPUs the calling thread may run on, in increasing order.
+std::vector<unsigned> CurrentThreadCpus() {
+  std::vector<unsigned> cpus;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) return cpus;
+  for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+// Every closure runs on a worker thread that is pinned to the CPUs of a single
+// NUMA node.
+TEST(WorkStealingThreadPoolTest, ThreadAffinity) {
+  constexpr size_t kRunCount = 1000;
+  std::map<int, std::vector<unsigned>> cpus_by_node;
+  for (const grpc_core::CpuInfo& info : grpc_core::GetCpuTopology()) {
+    cpus_by_node[info.numa_node].push_back(info.cpu);
+  }
+  ASSERT_FALSE(cpus_by_node.empty());
+  WorkStealingThreadPool::Options options;
+  options.thread_affinity = true;
+  WorkStealingThreadPool p(8, options);
+  std::atomic<size_t> run_count{0};
+  std::atomic<size_t> unpinned_count{0};
+  grpc_core::Notification finished;
+  auto check_affinity = [&] {
+    const std::vector<unsigned> cpus = CurrentThreadCpus();
+    const int cpu = sched_getcpu();
+    const bool pinned_to_a_node = std::any_of(
+        cpus_by_node.begin(), cpus_by_node.end(),
+        [&](const auto& node) { return node.second == cpus; });
+    if (!pinned_to_a_node || cpu < 0 ||
+        !std::binary_search(cpus.begin(), cpus.end(),
+                            static_cast<unsigned>(cpu))) {
+      unpinned_count.fetch_add(1);
+    }
+  };
+  for (size_t i = 0; i < kRunCount; i++) {
+    p.Run([&] {
+      check_affinity();
+      // Closures queued from worker threads are spread by stealing.
+      p.Run([&] {
+        check_affinity();
+        if (run_count.fetch_add(1) + 1 == kRunCount) finished.Notify();
+      });
+    });
+  }
+  finished.WaitForNotification();
+  p.Quiesce();
+  EXPECT_EQ(unpinned_count.load(), 0u);
+}
+#endif  // GPR_LINUX
+
+TEST(WorkStealingThreadPoolTest, ShardedGlobalQueue) {
+  constexpr size_t kProducerCount = 8;
+  constexpr size_t kRunCount = 1000;
+  WorkStealingThreadPool::Options options;
+  options.sharded_global_queue = true;
+  WorkStealingThreadPool p(8, options);
+  std::atomic<size_t> run_count{0};
+  grpc_core::Notification finished;
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducerCount; i++) {
+    producers.emplace_back([&] {
+      for (size_t j = 0; j < kRunCount; j++) {
+        p.Run([&] {
+          if (run_count.fetch_add(1) + 1 == kProducerCount * kRunCount) {
+            finished.Notify();
+          }
+        });
+      }
+    });
+  }
+  for (auto& producer : producers) producer.join();
+  finished.WaitForNotification();
+  p.Quiesce();
+}
+
 TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   TypeParam p1(8);
   for (size_t i = 0; i < 8; i++) {
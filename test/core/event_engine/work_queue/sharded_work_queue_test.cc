@@ -0,0 +1,184 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/sharded_work_queue.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/common_closures.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GPR_LINUX
+#include <sched.h>
+#endif
+
+namespace {
+using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::ShardedWorkQueue;
+
+// The queue only orders closures within a shard, and a thread adds to the
+// shard of the CPU it runs on. The ordering tests pin each producer to a CPU
+// so that all of its closures land in the same shard, and then only check the
+// order of the closures of each producer.
+constexpr int kMaxProducers = 4;
+constexpr int kClosuresPerProducer = 100;
+
+// Returns up to kMaxProducers CPUs this process may run on.
+std::vector<int> ProducerCpus() {
+  std::vector<int> cpus;
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) return cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE && cpus.size() < kMaxProducers; cpu++) {
+    if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+  }
+#endif
+  return cpus;
+}
+
+bool PinThisThread(int cpu) {
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+  (void)cpu;
+  return false;
+#endif
+}
+
+// Has one pinned thread per CPU of `cpus` add kClosuresPerProducer closures
+// to `queue`. Each closure appends its (producer, sequence number) to `ran`.
+void AddFromPinnedProducers(ShardedWorkQueue& queue,
+                            const std::vector<int>& cpus,
+                            std::vector<std::pair<int, int>>& ran) {
+  std::vector<std::thread> producers;
+  producers.reserve(cpus.size());
+  for (size_t p = 0; p < cpus.size(); p++) {
+    producers.emplace_back(
+        [&queue, &ran, cpu = cpus[p], producer = static_cast<int>(p)] {
+          ASSERT_TRUE(PinThisThread(cpu));
+          for (int i = 0; i < kClosuresPerProducer; i++) {
+            queue.Add([&ran, producer, i] { ran.emplace_back(producer, i); });
+          }
+        });
+  }
+  for (auto& producer : producers) producer.join();
+}
+
+TEST(ShardedWorkQueueTest, StartsEmpty) {
+  ShardedWorkQueue queue;
+  ASSERT_TRUE(queue.Empty());
+  ASSERT_EQ(queue.PopOldest(), nullptr);
+  ASSERT_EQ(queue.PopMostRecent(), nullptr);
+}
+
+TEST(ShardedWorkQueueTest, TakesClosures) {
+  ShardedWorkQueue queue;
+  bool ran = false;
+  AnyInvocableClosure closure([&ran] { ran = true; });
+  queue.Add(&closure);
+  ASSERT_FALSE(queue.Empty());
+  EXPECT_EQ(queue.Size(), 1u);
+  EventEngine::Closure* popped = queue.PopMostRecent();
+  ASSERT_NE(popped, nullptr);
+  popped->Run();
+  ASSERT_TRUE(ran);
+  ASSERT_TRUE(queue.Empty());
+}
+
+TEST(ShardedWorkQueueTest, FindsClosuresOfEveryShard) {
+  const std::vector<int> cpus = ProducerCpus();
+  if (cpus.empty()) GTEST_SKIP() << "cannot pin threads to CPUs";
+  ShardedWorkQueue queue;
+  std::vector<std::pair<int, int>> ran;
+  AddFromPinnedProducers(queue, cpus, ran);
+  EXPECT_EQ(queue.Size(), cpus.size() * kClosuresPerProducer);
+  while (auto* closure = queue.PopOldest()) closure->Run();
+  EXPECT_TRUE(queue.Empty());
+  EXPECT_EQ(ran.size(), cpus.size() * kClosuresPerProducer);
+}
+
+TEST(ShardedWorkQueueTest, PopOldestIsFIFOWithinAShard) {
+  const std::vector<int> cpus = ProducerCpus();
+  if (cpus.empty()) GTEST_SKIP() << "cannot pin threads to CPUs";
+  ShardedWorkQueue queue;
+  std::vector<std::pair<int, int>> ran;
+  AddFromPinnedProducers(queue, cpus, ran);
+  while (auto* closure = queue.PopOldest()) closure->Run();
+  std::vector<int> last(cpus.size(), -1);
+  for (const auto& [producer, i] : ran) {
+    EXPECT_GT(i, last[producer]) << "producer " << producer;
+    last[producer] = i;
+  }
+}
+
+TEST(ShardedWorkQueueTest, PopMostRecentIsLIFOWithinAShard) {
+  const std::vector<int> cpus = ProducerCpus();
+  if (cpus.empty()) GTEST_SKIP() << "cannot pin threads to CPUs";
+  ShardedWorkQueue queue;
+  std::vector<std::pair<int, int>> ran;
+  AddFromPinnedProducers(queue, cpus, ran);
+  while (auto* closure = queue.PopMostRecent()) closure->Run();
+  std::vector<int> last(cpus.size(), kClosuresPerProducer);
+  for (const auto& [producer, i] : ran) {
+    EXPECT_LT(i, last[producer]) << "producer " << producer;
+    last[producer] = i;
+  }
+}
+
+TEST(ShardedWorkQueueTest, ThreadedStress) {
+  ShardedWorkQueue queue;
+  constexpr int thd_count = 33;
+  constexpr int element_count_per_thd = 3333;
+  std::vector<std::thread> threads;
+  threads.reserve(thd_count);
+  class TestClosure : public EventEngine::Closure {
+   public:
+    void Run() override { delete this; }
+  };
+  for (int i = 0; i < thd_count; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < element_count_per_thd; j++) {
+        queue.Add(new TestClosure());
+      }
+      int run_count = 0;
+      while (run_count < element_count_per_thd) {
+        if (auto* c = queue.PopMostRecent()) {
+          c->Run();
+          ++run_count;
+        }
+      }
+    });
+  }
+  for (auto& thd : threads) thd.join();
+  EXPECT_TRUE(queue.Empty());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  auto result = RUN_ALL_TESTS();
+  return result;
+}
@@ -14,6 +14,8 @@
 
 #include "src/core/ext/transport/chaotic_good/config.h"
 
+#include <algorithm>
+#include <tuple>
 #include <vector>
 
 #include "fuzztest/fuzztest.h"
@@ -33,6 +35,10 @@ struct FuzzerChannelArgs {
   std::optional<int> max_send_chunk_size;
   std::optional<int> inlined_payload_size_threshold;
   std::optional<bool> tracing_enabled;
+  std::optional<bool> shared_memory;
+  std::optional<bool> adaptive_chunk_size;
+  std::optional<int> max_data_connections;
+  std::optional<bool> pooled_receive_buffers;
 
   ChannelArgs MakeChannelArgs() {
     ChannelArgs out;
@@ -46,6 +52,11 @@ struct FuzzerChannelArgs {
     transfer(inlined_payload_size_threshold,
              GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD);
     transfer(tracing_enabled, GRPC_ARG_TCP_TRACING_ENABLED);
+    transfer(shared_memory, GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_DATA_ENDPOINT);
+    transfer(adaptive_chunk_size, GRPC_ARG_CHAOTIC_GOOD_ADAPTIVE_CHUNK_SIZE);
+    transfer(max_data_connections, GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS);
+    transfer(pooled_receive_buffers,
+             GRPC_ARG_CHAOTIC_GOOD_POOLED_RECEIVE_BUFFERS);
     return out;
   }
 };
@@ -96,6 +107,33 @@ void ConfigTest(FuzzerChannelArgs client_args_input,
   EXPECT_EQ(client_options.decode_alignment, server_options.encode_alignment);
   EXPECT_EQ(client_chunker.alignment(), client_options.encode_alignment);
   EXPECT_EQ(server_chunker.alignment(), server_options.encode_alignment);
+  EXPECT_EQ(client_chunker.max_chunk_size(),
+            client_config.max_send_chunk_size());
+  EXPECT_EQ(server_chunker.max_chunk_size(),
+            server_config.max_send_chunk_size());
+  EXPECT_EQ(client_config.supports_shared_memory(),
+            server_config.supports_shared_memory());
+  EXPECT_EQ(client_config.supports_shared_memory(),
+            client_args_input.shared_memory.value_or(false) &&
+                server_args_input.shared_memory.value_or(false));
+  EXPECT_EQ(client_config.max_data_connections(),
+            server_config.max_data_connections());
+  EXPECT_LE(server_config.max_data_connections(),
+            std::max(0, client_args_input.max_data_connections.value_or(0)));
+  EXPECT_LE(server_config.max_data_connections(),
+            std::max(0, server_args_input.max_data_connections.value_or(0)));
+  for (const auto& [args, config, options] :
+       {std::tuple(&client_args_input, &client_config, &client_options),
+        std::tuple(&server_args_input, &server_config, &server_options)}) {
+    if (!args->pooled_receive_buffers.value_or(false)) {
+      EXPECT_EQ(options->receive_buffer_size, 0u);
+    }
+    if (options->receive_buffer_size != 0) {
+      EXPECT_GE(options->receive_buffer_size, config->max_recv_chunk_size());
+      EXPECT_EQ(options->receive_buffer_size % options->decode_alignment, 0u);
+      EXPECT_NE(options->memory_quota, nullptr);
+    }
+  }
   EXPECT_GE(server_config.max_recv_chunk_size(),
             client_config.max_send_chunk_size());
   EXPECT_GE(client_config.max_recv_chunk_size(),
@@ -53,6 +53,193 @@ std::vector<chaotic_good::PendingConnection> Endpoints(Args... args) {
   return connections;
 }
 
+TEST(WriteLoadTest, UnmeasuredEndpointUsesDefaultRate) {
+  chaotic_good::data_endpoints_detail::WriteLoad load;
+  const auto now = chaotic_good::data_endpoints_detail::WriteLoad::Clock::now();
+  EXPECT_FALSE(load.nanos_per_byte().has_value());
+  EXPECT_DOUBLE_EQ(load.EstimatedDelayNanos(1000, now, 2.0), 2000.0);
+}
+
+TEST(WriteLoadTest, LearnsRateFromLargeWrites) {
+  using Clock = chaotic_good::data_endpoints_detail::WriteLoad::Clock;
+  chaotic_good::data_endpoints_detail::WriteLoad load;
+  const auto start = Clock::now();
+  // Small writes don't produce a measurement.
+  load.BeginWrite(100, start);
+  load.EndWrite(true, start + std::chrono::microseconds(100));
+  EXPECT_FALSE(load.nanos_per_byte().has_value());
+  load.BeginWrite(100000, start);
+  load.EndWrite(true, start + std::chrono::microseconds(100));
+  ASSERT_TRUE(load.nanos_per_byte().has_value());
+  EXPECT_DOUBLE_EQ(*load.nanos_per_byte(), 1.0);
+  EXPECT_DOUBLE_EQ(load.EstimatedDelayNanos(5000, start, 100.0), 5000.0);
+}
+
+TEST(WriteLoadTest, StalledWriteRaisesEstimate) {
+  using Clock = chaotic_good::data_endpoints_detail::WriteLoad::Clock;
+  chaotic_good::data_endpoints_detail::WriteLoad load;
+  const auto start = Clock::now();
+  load.BeginWrite(100000, start);
+  load.EndWrite(true, start + std::chrono::microseconds(100));
+  load.BeginWrite(1000, start);
+  // 1ms for 1000 bytes in flight so far: at least 1000ns/byte.
+  EXPECT_DOUBLE_EQ(load.EstimatedDelayNanos(
+                       1000, start + std::chrono::milliseconds(1), 1.0),
+                   2000.0 * 1000.0);
+}
+
+TEST(WriteLoadTest, FailedWriteMarksEndpointFailed) {
+  using Clock = chaotic_good::data_endpoints_detail::WriteLoad::Clock;
+  chaotic_good::data_endpoints_detail::OutputBuffer buffer;
+  EXPECT_TRUE(buffer.CanAccept(10));
+  buffer.load().BeginWrite(10, Clock::now());
+  buffer.load().EndWrite(false, Clock::now());
+  EXPECT_FALSE(buffer.CanAccept(10));
+}
+
+TEST(WriteLoadTest, BusyTimeCoversOutstandingWrites) {
+  using Clock = chaotic_good::data_endpoints_detail::WriteLoad::Clock;
+  chaotic_good::data_endpoints_detail::WriteLoad load;
+  const auto start = Clock::now();
+  load.TakeBusyNanos(start);
+  load.BeginWrite(1000, start);
+  load.EndWrite(true, start + std::chrono::microseconds(1));
+  load.BeginWrite(1000, start + std::chrono::microseconds(3));
+  // 1us finished, plus 1us of the write still in flight.
+  EXPECT_DOUBLE_EQ(load.TakeBusyNanos(start + std::chrono::microseconds(4)),
+                   2000.0);
+  load.EndWrite(true, start + std::chrono::microseconds(5));
+  // Only the part of the write after the previous call counts.
+  EXPECT_DOUBLE_EQ(load.TakeBusyNanos(start + std::chrono::microseconds(6)),
+                   1000.0);
+}
+
+TEST(OutputBuffersTest, RetiredEndpointIsNotReady) {
+  auto buffers =
+      MakeRefCounted<chaotic_good::data_endpoints_detail::OutputBuffers>();
+  buffers->AddEndpoint(0);
+  buffers->AddEndpoint(1);
+  EXPECT_EQ(buffers->ReadyEndpoints(), 2u);
+  // Nothing measured yet: the newest endpoint goes first.
+  EXPECT_EQ(buffers->EndpointToRetire(), 1u);
+  buffers->Retire(1);
+  EXPECT_EQ(buffers->ReadyEndpoints(), 1u);
+  // Never retire the last endpoint.
+  EXPECT_EQ(buffers->EndpointToRetire(), std::nullopt);
+}
+
+TEST(OutputBuffersTest, KeptEndpointIsNotRetired) {
+  auto buffers =
+      MakeRefCounted<chaotic_good::data_endpoints_detail::OutputBuffers>();
+  // Kept before it connects, like the shared memory endpoint.
+  buffers->Keep(2);
+  buffers->AddEndpoint(0);
+  buffers->AddEndpoint(1);
+  buffers->AddEndpoint(2);
+  EXPECT_EQ(buffers->EndpointToRetire(), 1u);
+  buffers->Retire(1);
+  EXPECT_EQ(buffers->EndpointToRetire(), 0u);
+  buffers->Retire(0);
+  EXPECT_EQ(buffers->ReadyEndpoints(), 1u);
+  EXPECT_EQ(buffers->EndpointToRetire(), std::nullopt);
+}
+
+TEST(OutputBuffersTest, FailedEndpointIsNotScheduled) {
+  auto buffers =
+      MakeRefCounted<chaotic_good::data_endpoints_detail::OutputBuffers>();
+  auto write = [&buffers](absl::string_view data) -> std::optional<uint32_t> {
+    auto poll = buffers->Write(SliceBuffer(Slice::FromCopiedString(data)))();
+    if (poll.pending()) return std::nullopt;
+    return poll.value();
+  };
+  buffers->AddEndpoint(0);
+  buffers->AddEndpoint(1);
+  // With nothing queued or measured, the first endpoint wins the tie.
+  EXPECT_EQ(write("a"), 0u);
+  EXPECT_TRUE(buffers->Next(0)().ready());
+  buffers->WriteCompleted(0, false);
+  EXPECT_EQ(write("b"), 1u);
+  EXPECT_EQ(write("c"), 1u);
+}
+
+TEST(OutputBuffersTest, RetireBeforeAdd) {
+  auto buffers =
+      MakeRefCounted<chaotic_good::data_endpoints_detail::OutputBuffers>();
+  buffers->AddEndpoint(0);
+  buffers->Retire(1);
+  buffers->AddEndpoint(1);
+  EXPECT_EQ(buffers->ReadyEndpoints(), 1u);
+}
+
+TEST(DataEndpointScalerTest, AddsUnderSustainedLoad) {
+  using Action = chaotic_good::DataEndpointScaler::Action;
+  chaotic_good::DataEndpointScaler scaler(1, 3);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kAdd);
+  // Wait for the new endpoint...
+  EXPECT_EQ(scaler.Sample(1, 1.0), Action::kNone);
+  EXPECT_EQ(scaler.Sample(2, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(2, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(2, 0.9), Action::kAdd);
+  EXPECT_EQ(scaler.Sample(3, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(3, 0.9), Action::kNone);
+  // ... but never beyond the maximum.
+  EXPECT_EQ(scaler.Sample(3, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(3, 0.9), Action::kNone);
+}
+
+TEST(DataEndpointScalerTest, BriefBurstsDoNotAdd) {
+  using Action = chaotic_good::DataEndpointScaler::Action;
+  chaotic_good::DataEndpointScaler scaler(1, 4);
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(scaler.Sample(2, i % 3 == 2 ? 0.5 : 0.9), Action::kNone);
+  }
+}
+
+TEST(DataEndpointScalerTest, RetiresWhenIdle) {
+  using Action = chaotic_good::DataEndpointScaler::Action;
+  chaotic_good::DataEndpointScaler scaler(1, 4);
+  for (int i = 1;
+       i < chaotic_good::DataEndpointScaler::kScaleDownSamples; ++i) {
+    EXPECT_EQ(scaler.Sample(2, 0.1), Action::kNone);
+  }
+  EXPECT_EQ(scaler.Sample(2, 0.1), Action::kRetire);
+  for (int i = 0;
+       i < 2 * chaotic_good::DataEndpointScaler::kScaleDownSamples; ++i) {
+    EXPECT_EQ(scaler.Sample(1, 0.0), Action::kNone);
+  }
+}
+
+TEST(DataEndpointScalerTest, GivesUpOnEndpointThatNeverConnects) {
+  using Action = chaotic_good::DataEndpointScaler::Action;
+  chaotic_good::DataEndpointScaler scaler(1, 4);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kAdd);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kNone);
+  EXPECT_EQ(scaler.Sample(1, 0.9), Action::kAdd);
+}
+
+TEST(DataEndpointScalerTest, StopsAddingWhenEndpointsNeverConnect) {
+  using Action = chaotic_good::DataEndpointScaler::Action;
+  chaotic_good::DataEndpointScaler scaler(1, 4);
+  int adds = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (scaler.Sample(1, 0.9) == Action::kAdd) ++adds;
+  }
+  EXPECT_EQ(adds, chaotic_good::DataEndpointScaler::kMaxUnconnectedAdds);
+  // One of them connects after all: scaling resumes.
+  adds = 0;
+  for (int i = 0; i < 4; ++i) {
+    if (scaler.Sample(2, 0.9) == Action::kAdd) ++adds;
+  }
+  EXPECT_EQ(adds, 1);
+}
+
 DATA_ENDPOINTS_TEST(CanWrite) {
   chaotic_good::testing::MockPromiseEndpoint ep(1234);
   chaotic_good::DataEndpoints data_endpoints(
@@ -111,4 +298,24 @@ DATA_ENDPOINTS_TEST(CanRead) {
   WaitForAllPendingWork();
 }
 
+DATA_ENDPOINTS_TEST(AddedEndpointTakesOverFromRetiredOne) {
+  chaotic_good::testing::MockPromiseEndpoint ep1(1234);
+  chaotic_good::testing::MockPromiseEndpoint ep2(1235);
+  chaotic_good::DataEndpoints data_endpoints(
+      Endpoints(std::move(ep1.promise_endpoint)), event_engine().get(), false);
+  EXPECT_EQ(data_endpoints.AddEndpoint(chaotic_good::ImmediateConnection(
+                "bar", std::move(ep2.promise_endpoint))),
+            1u);
+  EXPECT_EQ(data_endpoints.size(), 2u);
+  data_endpoints.StopWriting(0);
+  ep2.ExpectWrite(
+      {grpc_event_engine::experimental::Slice::FromCopiedString("hello")},
+      event_engine().get());
+  SpawnTestSeqWithoutContext(
+      "write",
+      data_endpoints.Write(SliceBuffer(Slice::FromCopiedString("hello"))),
+      [](uint32_t id) { EXPECT_EQ(id, 1); });
+  WaitForAllPendingWork();
+}
+
 }  // namespace grpc_core
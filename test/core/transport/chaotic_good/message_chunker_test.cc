@@ -89,5 +89,62 @@ void MessageChunkerTest(uint32_t max_chunk_size, uint32_t alignment,
 }
 FUZZ_TEST(MyTestSuite, MessageChunkerTest);
 
+TEST(ChunkSizePolicyTest, StartsAtNegotiatedMaximum) {
+  chaotic_good::ChunkSizePolicy policy(1024 * 1024, 64);
+  EXPECT_EQ(policy.chunk_size(), 1024 * 1024);
+  EXPECT_EQ(policy.ChunkSizeFor(100), 0);
+}
+
+TEST(ChunkSizePolicyTest, SplitsTypicalMessagesAcrossEndpoints) {
+  chaotic_good::ChunkSizePolicy policy(4 * 1024 * 1024, 64);
+  policy.SetDataEndpoints(4, 1.0);
+  EXPECT_EQ(policy.ChunkSizeFor(2 * 1024 * 1024), 512 * 1024);
+  // Small messages are never chunked.
+  EXPECT_EQ(policy.ChunkSizeFor(10 * 1024), 0);
+  // Uneven endpoints ask for more, smaller pieces.
+  policy.SetDataEndpoints(4, 2.0);
+  EXPECT_EQ(policy.chunk_size(), 256 * 1024);
+}
+
+TEST(ChunkSizePolicyTest, NeverBelowMinimumOrAboveMaximum) {
+  chaotic_good::ChunkSizePolicy policy(256 * 1024, 64);
+  policy.SetDataEndpoints(64, 1.0);
+  policy.ChunkSizeFor(1024 * 1024);
+  EXPECT_EQ(policy.chunk_size(), chaotic_good::ChunkSizePolicy::kMinChunkSize);
+  policy.SetDataEndpoints(1, 1.0);
+  for (int i = 0; i < 100; ++i) policy.ChunkSizeFor(64 * 1024 * 1024);
+  EXPECT_EQ(policy.chunk_size(), 256 * 1024);
+}
+
+TEST(ChunkSizePolicyTest, SmallDriftDoesNotMoveChunkSize) {
+  chaotic_good::ChunkSizePolicy policy(4 * 1024 * 1024, 64);
+  policy.ChunkSizeFor(1024 * 1024);
+  EXPECT_EQ(policy.chunk_size(), 1024 * 1024);
+  // Average moves to 1.125MiB: within 25%, so the chunk size holds.
+  policy.ChunkSizeFor(2 * 1024 * 1024);
+  EXPECT_EQ(policy.chunk_size(), 1024 * 1024);
+  // Keep pushing and it eventually follows.
+  for (int i = 0; i < 10; ++i) policy.ChunkSizeFor(2 * 1024 * 1024);
+  EXPECT_GT(policy.chunk_size(), 1024 * 1024);
+}
+
+TEST(ChunkSizePolicyTest, ChunkerUsesPolicy) {
+  auto policy = MakeRefCounted<chaotic_good::ChunkSizePolicy>(1024 * 1024, 1);
+  policy->SetDataEndpoints(2, 1.0);
+  chaotic_good::MessageChunker chunker(1024 * 1024, 1, policy);
+  Sender sender;
+  EXPECT_THAT(chunker.Send(Arena::MakePooled<Message>(
+                               SliceBuffer(Slice::FromCopiedString(
+                                   std::string(200 * 1024, 'a'))),
+                               0),
+                           1, sender)(),
+              IsReady(true));
+  // BeginMessage plus two 100KiB chunks.
+  ASSERT_EQ(sender.frames.size(), 3);
+  EXPECT_EQ(std::get<chaotic_good::MessageChunkFrame>(sender.frames[1])
+                .payload.Length(),
+            100 * 1024);
+}
+
 }  // namespace
 }  // namespace grpc_core
@@ -0,0 +1,148 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/receive_buffer_pool.h"
+
+#include <grpc/slice.h>
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+bool IsAligned(const void* p, size_t alignment) {
+  return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+
+RefCountedPtr<ReceiveBufferPool> MakePool(
+    size_t buffer_size, size_t alignment = 64,
+    MemoryQuotaRefPtr memory_quota = MakeMemoryQuota("test")) {
+  return MakeRefCounted<ReceiveBufferPool>(ReceiveBufferPool::Options{
+      buffer_size, alignment, std::move(memory_quota)});
+}
+
+TEST(ReceiveBufferPoolTest, SlicesAreAligned) {
+  for (size_t alignment : {1, 16, 64, 4096}) {
+    auto pool = MakePool(1000, alignment);
+    for (size_t length : {1, 999, 1000, 5000}) {
+      MutableSlice slice = pool->Allocate(length);
+      EXPECT_EQ(slice.length(), length);
+      EXPECT_TRUE(IsAligned(slice.data(), alignment))
+          << alignment << " " << length;
+    }
+  }
+}
+
+TEST(ReceiveBufferPoolTest, ReleasedBufferIsReused) {
+  auto pool = MakePool(1024);
+  uint8_t* first;
+  {
+    MutableSlice slice = pool->Allocate(1000);
+    first = slice.data();
+    EXPECT_EQ(pool->idle_buffers(), 0u);
+  }
+  EXPECT_EQ(pool->idle_buffers(), 1u);
+  MutableSlice slice = pool->Allocate(1024);
+  EXPECT_EQ(slice.data(), first);
+  EXPECT_EQ(pool->idle_buffers(), 0u);
+}
+
+TEST(ReceiveBufferPoolTest, OddSizedBuffersAreNotKept) {
+  auto pool = MakePool(1024);
+  { MutableSlice slice = pool->Allocate(1025); }
+  EXPECT_EQ(pool->idle_buffers(), 0u);
+  { MutableSlice slice = pool->Allocate(512); }
+  EXPECT_EQ(pool->idle_buffers(), 0u);
+  { MutableSlice slice = pool->Allocate(513); }
+  EXPECT_EQ(pool->idle_buffers(), 1u);
+}
+
+TEST(ReceiveBufferPoolTest, IdleBuffersAreBounded) {
+  auto pool = MakePool(1024);
+  {
+    std::vector<MutableSlice> slices;
+    for (size_t i = 0; i < 2 * ReceiveBufferPool::kMaxIdleBuffers; ++i) {
+      slices.push_back(pool->Allocate(1024));
+    }
+  }
+  EXPECT_EQ(pool->idle_buffers(), ReceiveBufferPool::kMaxIdleBuffers);
+}
+
+TEST(ReceiveBufferPoolTest, SliceOutlivesPool) {
+  auto pool = MakePool(1024);
+  Slice slice(pool->Allocate(10));
+  pool.reset();
+  EXPECT_EQ(slice.length(), 10u);
+}
+
+TEST(ReceiveBufferPoolTest, BuffersAreChargedToQuota) {
+  auto memory_quota = MakeMemoryQuota("test");
+  memory_quota->SetSize(1024 * 1024);
+  MemoryOwner owner = memory_quota->CreateMemoryOwner();
+  auto pressure = [&owner]() {
+    return owner.GetPressureInfo().instantaneous_pressure;
+  };
+  const double baseline = pressure();
+  auto pool = MakePool(64 * 1024, 64, memory_quota);
+  {
+    MutableSlice pooled = pool->Allocate(64 * 1024);
+    MutableSlice oversized = pool->Allocate(128 * 1024);
+    EXPECT_GE(pressure(), baseline + 192.0 * 1024 / (1024 * 1024));
+  }
+  // The idle buffer is still held, and still charged.
+  EXPECT_EQ(pool->idle_buffers(), 1u);
+  EXPECT_GE(pressure(), baseline + 64.0 * 1024 / (1024 * 1024));
+  pool.reset();
+  EXPECT_EQ(pressure(), baseline);
+}
+
+TEST(ReceiveBufferPoolTest, GatherFlattensFragments) {
+  auto pool = MakePool(16);
+  SliceBuffer payload;
+  payload.Append(Slice::FromCopiedString("hello "));
+  payload.Append(Slice::FromCopiedString("world"));
+  SliceBuffer gathered = pool->Gather(std::move(payload));
+  ASSERT_EQ(gathered.Count(), 1u);
+  EXPECT_TRUE(IsAligned(GRPC_SLICE_START_PTR(gathered.c_slice_at(0)), 64));
+  EXPECT_EQ(gathered.JoinIntoString(), "hello world");
+  gathered.Clear();
+  EXPECT_EQ(pool->idle_buffers(), 1u);
+}
+
+TEST(ReceiveBufferPoolTest, GatherKeepsAlignedSlice) {
+  auto pool = MakePool(1024);
+  auto other = MakePool(1024);
+  MutableSlice slice = other->Allocate(100);
+  const uint8_t* data = slice.data();
+  SliceBuffer payload;
+  payload.Append(Slice(std::move(slice)));
+  SliceBuffer gathered = pool->Gather(std::move(payload));
+  ASSERT_EQ(gathered.Count(), 1u);
+  EXPECT_EQ(GRPC_SLICE_START_PTR(gathered.c_slice_at(0)), data);
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,287 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_endpoint.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+#include <sys/socket.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/notification.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+using grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::EventEngineSupportsFdExtension;
+using grpc_event_engine::experimental::GetDefaultEventEngine;
+using grpc_event_engine::experimental::QueryExtension;
+using grpc_event_engine::experimental::Slice;
+using grpc_event_engine::experimental::SliceBuffer;
+
+std::string TestPayload(size_t length) {
+  std::string payload(length, 0);
+  for (size_t i = 0; i < length; ++i) {
+    payload[i] = static_cast<char>((i * 131) >> 3);
+  }
+  return payload;
+}
+
+std::string Flatten(SliceBuffer& buffer) {
+  std::string out(buffer.Length(), 0);
+  buffer.MoveFirstNBytesIntoBuffer(buffer.Length(), out.data());
+  return out;
+}
+
+// A connected pair of doorbells, as the handshake would set up.
+std::pair<std::unique_ptr<EventEngine::Endpoint>,
+          std::unique_ptr<EventEngine::Endpoint>>
+MakeDoorbells(EventEngine* event_engine) {
+  auto* supports_fd =
+      QueryExtension<EventEngineSupportsFdExtension>(event_engine);
+  CHECK_NE(supports_fd, nullptr);
+  int fds[2];
+  CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  MemoryQuota memory_quota("doorbell");
+  auto make = [&](int fd) {
+    return supports_fd->CreatePosixEndpointFromFd(
+        fd, ChannelArgsEndpointConfig(ChannelArgs()),
+        memory_quota.CreateMemoryAllocator("doorbell"));
+  };
+  return {make(fds[0]), make(fds[1])};
+}
+
+TEST(SharedMemoryRegionTest, RingsWrapAround) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  auto client = SharedMemoryRegion::Attach((*server)->name());
+  ASSERT_TRUE(client.ok()) << client.status();
+  EXPECT_TRUE((*server)->peer_attached());
+  const std::string payload = TestPayload(50000);
+  SliceBuffer pending;
+  pending.Append(Slice::FromCopiedString(payload));
+  SliceBuffer received;
+  while (received.Length() < payload.size()) {
+    // Odd sized reads keep the ring offsets moving relative to the wrap point.
+    ASSERT_TRUE((*server)->Write(SharedMemoryRegion::Side::kServer, pending)
+                    .ok());
+    ASSERT_TRUE(
+        (*client)->Read(SharedMemoryRegion::Side::kClient, 3001, received)
+            .ok());
+  }
+  EXPECT_EQ(pending.Length(), 0u);
+  EXPECT_EQ(Flatten(received), payload);
+  // Nothing went the other way.
+  EXPECT_EQ((*server)->ReadableBytes(SharedMemoryRegion::Side::kServer), 0u);
+  EXPECT_EQ((*client)->WritableBytes(SharedMemoryRegion::Side::kClient),
+            4096u);
+}
+
+TEST(SharedMemoryRegionTest, WriteStopsWhenRingIsFull) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  SliceBuffer data;
+  data.Append(Slice::FromCopiedString(TestPayload(10000)));
+  EXPECT_EQ(*(*server)->Write(SharedMemoryRegion::Side::kServer, data), 4096u);
+  EXPECT_EQ(data.Length(), 10000u - 4096u);
+  EXPECT_EQ(*(*server)->Write(SharedMemoryRegion::Side::kServer, data), 0u);
+}
+
+TEST(SharedMemoryRegionTest, WritePositionOutOfRangeClosesRegion) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  auto client = SharedMemoryRegion::Attach((*server)->name());
+  ASSERT_TRUE(client.ok()) << client.status();
+  (*server)->TestOnlySetRingPositions(SharedMemoryRegion::Side::kServer,
+                                      10 * 4096, 0);
+  EXPECT_EQ((*client)->ReadableBytes(SharedMemoryRegion::Side::kClient), 0u);
+  SliceBuffer out;
+  EXPECT_EQ(
+      (*client)->Read(SharedMemoryRegion::Side::kClient, 4096, out).status()
+          .code(),
+      absl::StatusCode::kDataLoss);
+  EXPECT_EQ(out.Length(), 0u);
+  EXPECT_TRUE((*server)->closed());
+}
+
+TEST(SharedMemoryRegionTest, ReadPositionOutOfRangeClosesRegion) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  auto client = SharedMemoryRegion::Attach((*server)->name());
+  ASSERT_TRUE(client.ok()) << client.status();
+  // Reader ahead of the writer.
+  (*client)->TestOnlySetRingPositions(SharedMemoryRegion::Side::kServer, 0,
+                                      100);
+  SliceBuffer data;
+  data.Append(Slice::FromCopiedString(TestPayload(10)));
+  EXPECT_EQ((*server)->WritableBytes(SharedMemoryRegion::Side::kServer), 0u);
+  EXPECT_EQ((*server)
+                ->Write(SharedMemoryRegion::Side::kServer, data)
+                .status()
+                .code(),
+            absl::StatusCode::kDataLoss);
+  EXPECT_EQ(data.Length(), 10u);
+  EXPECT_TRUE((*client)->closed());
+}
+
+TEST(SharedMemoryRegionTest, ReadPositionGoingBackwardsClosesRegion) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  auto client = SharedMemoryRegion::Attach((*server)->name());
+  ASSERT_TRUE(client.ok()) << client.status();
+  SliceBuffer data;
+  data.Append(Slice::FromCopiedString(TestPayload(200)));
+  EXPECT_EQ(*(*server)->Write(SharedMemoryRegion::Side::kServer, data), 200u);
+  SliceBuffer out;
+  EXPECT_EQ(*(*client)->Read(SharedMemoryRegion::Side::kClient, 100, out),
+            100u);
+  data.Append(Slice::FromCopiedString(TestPayload(10)));
+  EXPECT_EQ(*(*server)->Write(SharedMemoryRegion::Side::kServer, data), 10u);
+  (*client)->TestOnlySetRingPositions(SharedMemoryRegion::Side::kServer, 210,
+                                      50);
+  data.Append(Slice::FromCopiedString(TestPayload(10)));
+  EXPECT_EQ((*server)
+                ->Write(SharedMemoryRegion::Side::kServer, data)
+                .status()
+                .code(),
+            absl::StatusCode::kDataLoss);
+}
+
+TEST(SharedMemoryRegionTest, OnlyOneClientMayAttach) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  auto first = SharedMemoryRegion::Attach((*server)->name());
+  ASSERT_TRUE(first.ok()) << first.status();
+  auto second = SharedMemoryRegion::Attach((*server)->name());
+  EXPECT_EQ(second.status().code(), absl::StatusCode::kFailedPrecondition);
+}
+
+TEST(SharedMemoryRegionTest, RejectsForeignNames) {
+  EXPECT_EQ(SharedMemoryRegion::Attach("/some_other_segment").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(SharedMemoryRegion::Attach("/grpc_chaotic_good_/x").status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST(SharedMemoryRegionTest, UnlinkedRegionsCannotBeAttached) {
+  auto server = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(server.ok()) << server.status();
+  (*server)->Unlink();
+  EXPECT_FALSE(SharedMemoryRegion::Attach((*server)->name()).ok());
+}
+
+TEST(SharedMemoryEndpointTest, LargeWriteIsReceivedInOrder) {
+  auto event_engine = GetDefaultEventEngine();
+  auto region = SharedMemoryRegion::Create(64 * 1024);
+  ASSERT_TRUE(region.ok()) << region.status();
+  auto peer = SharedMemoryRegion::Attach((*region)->name());
+  ASSERT_TRUE(peer.ok()) << peer.status();
+  auto doorbells = MakeDoorbells(event_engine.get());
+  auto server = MakeSharedMemoryEndpoint(*region,
+                                         SharedMemoryRegion::Side::kServer,
+                                         std::move(doorbells.first),
+                                         event_engine);
+  auto client = MakeSharedMemoryEndpoint(*peer,
+                                         SharedMemoryRegion::Side::kClient,
+                                         std::move(doorbells.second),
+                                         event_engine);
+  const std::string payload = TestPayload(4 * 1024 * 1024);
+  SliceBuffer to_send;
+  to_send.Append(Slice::FromCopiedString(payload));
+  Notification write_done;
+  if (server->Write(
+          [&write_done](absl::Status status) {
+            EXPECT_TRUE(status.ok()) << status;
+            write_done.Notify();
+          },
+          &to_send, nullptr)) {
+    write_done.Notify();
+  }
+  SliceBuffer received;
+  while (received.Length() < payload.size()) {
+    SliceBuffer chunk;
+    Notification read_done;
+    if (client->Read(
+            [&read_done](absl::Status status) {
+              EXPECT_TRUE(status.ok()) << status;
+              read_done.Notify();
+            },
+            &chunk, nullptr)) {
+      read_done.Notify();
+    }
+    read_done.WaitForNotification();
+    ASSERT_GT(chunk.Length(), 0u);
+    while (chunk.Length() > 0) received.Append(chunk.TakeFirst());
+  }
+  write_done.WaitForNotification();
+  EXPECT_EQ(Flatten(received), payload);
+}
+
+TEST(SharedMemoryEndpointTest, PeerShutdownFailsPendingRead) {
+  auto event_engine = GetDefaultEventEngine();
+  auto region = SharedMemoryRegion::Create(4096);
+  ASSERT_TRUE(region.ok()) << region.status();
+  auto peer = SharedMemoryRegion::Attach((*region)->name());
+  ASSERT_TRUE(peer.ok()) << peer.status();
+  auto doorbells = MakeDoorbells(event_engine.get());
+  auto server = MakeSharedMemoryEndpoint(*region,
+                                         SharedMemoryRegion::Side::kServer,
+                                         std::move(doorbells.first),
+                                         event_engine);
+  auto client = MakeSharedMemoryEndpoint(*peer,
+                                         SharedMemoryRegion::Side::kClient,
+                                         std::move(doorbells.second),
+                                         event_engine);
+  SliceBuffer buffer;
+  Notification read_done;
+  absl::Status read_status;
+  EXPECT_FALSE(client->Read(
+      [&](absl::Status status) {
+        read_status = status;
+        read_done.Notify();
+      },
+      &buffer, nullptr));
+  server.reset();
+  read_done.WaitForNotification();
+  EXPECT_EQ(read_status.code(), absl::StatusCode::kUnavailable);
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  // Must call to create default EventEngine.
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,315 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives a server chttp2 transport with raw HTTP/2 frames and checks that
+// receiving several DATA frames of a stream in one read completes the pending
+// receive once, with the frames' bytes in order, and that trailing metadata
+// received in the same read is still delivered after the data.
+
+#include <grpc/byte_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/server/server.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/useful.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+// HEADERS frame (END_HEADERS) opening stream 1 without ending it.
+constexpr char kRequestHeadersFrame[] =
+    "\x00\x00\xbe\x01\x04\x00\x00\x00\x01"
+    "\x10\x05:path\x08/foo/bar"
+    "\x10\x07:scheme\x04http"
+    "\x10\x07:method\x04POST"
+    "\x10\x0a:authority\x09localhost"
+    "\x10\x0c"
+    "content-type\x10"
+    "application/grpc"
+    "\x10\x14grpc-accept-encoding\x15identity,deflate,gzip"
+    "\x10\x02te\x08trailers"
+    "\x10\x0auser-agent\x17grpc-c/0.12.0.0 (linux)";
+
+// Empty trailing HEADERS frame (END_STREAM | END_HEADERS) for stream 1.
+constexpr char kTrailersFrame[] = "\x00\x00\x00\x01\x05\x00\x00\x00\x01";
+
+// Returns a DATA frame for stream 1 carrying `payload`.
+std::string DataFrame(absl::string_view payload) {
+  CHECK_LT(payload.size(), 1u << 24);
+  std::string frame;
+  frame.push_back(static_cast<char>(payload.size() >> 16));
+  frame.push_back(static_cast<char>(payload.size() >> 8));
+  frame.push_back(static_cast<char>(payload.size()));
+  frame.append("\x00\x00\x00\x00\x00\x01", 6);
+  absl::StrAppend(&frame, payload);
+  return frame;
+}
+
+// Returns `message` with its gRPC length prefix.
+std::string GrpcMessage(absl::string_view message) {
+  CHECK_LT(message.size(), 256u);
+  std::string framed(4, '\0');
+  framed.push_back(static_cast<char>(message.size()));
+  absl::StrAppend(&framed, message);
+  return framed;
+}
+
+// The parameter enables GRPC_ARG_HTTP2_BATCH_READ_COMPLETIONS on the server.
+// Receives must behave the same either way.
+class BatchReadCompletionsTest : public ::testing::TestWithParam<bool> {
+ protected:
+  BatchReadCompletionsTest() { SetupAndStart(); }
+
+  ~BatchReadCompletionsTest() override { ShutdownAndDestroy(); }
+
+  void SetupAndStart() {
+    ExecCtx exec_ctx;
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    grpc_arg server_args[] = {
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_HTTP2_BDP_PROBE), 0),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_KEEPALIVE_TIME_MS), INT_MAX),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>("grpc.experimental.http2_batch_read_completions"),
+            GetParam())};
+    grpc_channel_args server_channel_args = {GPR_ARRAY_SIZE(server_args),
+                                             server_args};
+    server_ = grpc_server_create(&server_channel_args, nullptr);
+    auto* core_server = Server::FromC(server_);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    fds_ = grpc_iomgr_create_endpoint_pair("fixture", nullptr);
+    auto* transport = grpc_create_chttp2_transport(
+        core_server->channel_args(), OrphanablePtr<grpc_endpoint>(fds_.server),
+        false);
+    grpc_endpoint_add_to_pollset(fds_.server, grpc_cq_pollset(cq_));
+    CHECK(core_server->SetupTransport(transport, nullptr,
+                                      core_server->channel_args(),
+                                      nullptr) == absl::OkStatus());
+    grpc_chttp2_transport_start_reading(transport, nullptr, nullptr, nullptr,
+                                        nullptr);
+    // Poll the client endpoint so that writes to the server make progress.
+    Notification client_poller_thread_started_notification;
+    client_poll_thread_ = std::make_unique<std::thread>(
+        [this, &client_poller_thread_started_notification]() {
+          grpc_completion_queue* client_cq =
+              grpc_completion_queue_create_for_next(nullptr);
+          {
+            ExecCtx exec_ctx;
+            grpc_endpoint_add_to_pollset(fds_.client,
+                                         grpc_cq_pollset(client_cq));
+            grpc_endpoint_add_to_pollset(fds_.server,
+                                         grpc_cq_pollset(client_cq));
+          }
+          client_poller_thread_started_notification.Notify();
+          while (!shutdown_) {
+            CHECK(grpc_completion_queue_next(
+                      client_cq, grpc_timeout_milliseconds_to_deadline(10),
+                      nullptr)
+                      .type == GRPC_QUEUE_TIMEOUT);
+          }
+          grpc_completion_queue_destroy(client_cq);
+        });
+    client_poller_thread_started_notification.WaitForNotification();
+    // Write connection prefix and settings frame
+    constexpr char kPrefix[] =
+        "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n\x00\x00\x00\x04\x00\x00\x00\x00\x00";
+    Write(absl::string_view(kPrefix, sizeof(kPrefix) - 1));
+  }
+
+  void ShutdownAndDestroy() {
+    shutdown_ = true;
+    ExecCtx exec_ctx;
+    grpc_endpoint_destroy(fds_.client);
+    ExecCtx::Get()->Flush();
+    client_poll_thread_->join();
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    grpc_server_cancel_all_calls(server_);
+    cqv_->Expect(Tag(1000), true);
+    cqv_->Verify();
+    grpc_server_destroy(server_);
+    cqv_.reset();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  // Writes `bytes` to the server in a single endpoint write, and waits for
+  // the write to complete.
+  void Write(absl::string_view bytes) {
+    ExecCtx exec_ctx;
+    grpc_slice_buffer buffer;
+    grpc_slice_buffer_init(&buffer);
+    grpc_slice_buffer_add(&buffer,
+                          grpc_slice_from_copied_buffer(bytes.data(),
+                                                        bytes.size()));
+    Notification on_write_done_notification;
+    GRPC_CLOSURE_INIT(&on_write_done_, OnWriteDone,
+                      &on_write_done_notification, nullptr);
+    grpc_endpoint_write(fds_.client, &buffer, &on_write_done_, nullptr,
+                        /*max_frame_size=*/INT_MAX);
+    ExecCtx::Get()->Flush();
+    CHECK(on_write_done_notification.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_slice_buffer_destroy(&buffer);
+  }
+
+  static void OnWriteDone(void* arg, grpc_error_handle error) {
+    if (!error.ok()) {
+      Crash(absl::StrCat("Write failed: ", error.ToString()));
+    }
+    static_cast<Notification*>(arg)->Notify();
+  }
+
+  // Starts a batch with a single RECV_MESSAGE op on `call`.
+  void StartRecvMessage(grpc_call* call, grpc_byte_buffer** message,
+                        intptr_t tag) {
+    grpc_op op;
+    memset(&op, 0, sizeof(op));
+    op.op = GRPC_OP_RECV_MESSAGE;
+    op.data.recv_message.recv_message = message;
+    CHECK_EQ(grpc_call_start_batch(call, &op, 1, Tag(tag), nullptr),
+             GRPC_CALL_OK);
+  }
+
+  grpc_endpoint_pair fds_;
+  grpc_server* server_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+  std::unique_ptr<CqVerifier> cqv_;
+  std::unique_ptr<std::thread> client_poll_thread_;
+  std::atomic<bool> shutdown_{false};
+  grpc_closure on_write_done_;
+};
+
+TEST_P(BatchReadCompletionsTest, DataFramesOfOneReadCompleteOnceInOrder) {
+  grpc_call* s;
+  grpc_call_details call_details;
+  grpc_metadata_array request_metadata_recv;
+  grpc_call_details_init(&call_details);
+  grpc_metadata_array_init(&request_metadata_recv);
+  CHECK_EQ(grpc_server_request_call(server_, &s, &call_details,
+                                    &request_metadata_recv, cq_, cq_,
+                                    Tag(100)),
+           GRPC_CALL_OK);
+  Write(absl::string_view(kRequestHeadersFrame,
+                          sizeof(kRequestHeadersFrame) - 1));
+  cqv_->Expect(Tag(100), true);
+  cqv_->Verify();
+  // Have a receive pending before any DATA frame arrives, so that it is
+  // completed by the read that carries the frames.
+  grpc_byte_buffer* first = nullptr;
+  StartRecvMessage(s, &first, 101);
+  // Two messages, each split across several DATA frames, and the trailers,
+  // all in one write.
+  const std::string hello = GrpcMessage("hello");
+  const std::string world = GrpcMessage("world");
+  Write(absl::StrCat(DataFrame(hello.substr(0, 3)),
+                     DataFrame(hello.substr(3, 4)), DataFrame(hello.substr(7)),
+                     DataFrame(world.substr(0, 6)), DataFrame(world.substr(6)),
+                     absl::string_view(kTrailersFrame,
+                                       sizeof(kTrailersFrame) - 1)));
+  cqv_->Expect(Tag(101), true);
+  cqv_->Verify();
+  ASSERT_NE(first, nullptr);
+  EXPECT_TRUE(byte_buffer_eq_string(first, "hello"));
+  grpc_byte_buffer* second = nullptr;
+  StartRecvMessage(s, &second, 102);
+  cqv_->Expect(Tag(102), true);
+  cqv_->Verify();
+  ASSERT_NE(second, nullptr);
+  EXPECT_TRUE(byte_buffer_eq_string(second, "world"));
+  // The trailers end the stream only after both messages were delivered.
+  grpc_byte_buffer* end_of_stream = nullptr;
+  StartRecvMessage(s, &end_of_stream, 103);
+  cqv_->Expect(Tag(103), true);
+  cqv_->Verify();
+  EXPECT_EQ(end_of_stream, nullptr);
+  // Finish the call; the client half-closed cleanly so it is not cancelled.
+  grpc_op ops[3];
+  memset(ops, 0, sizeof(ops));
+  grpc_op* op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+  op->data.send_status_from_server.status_details = &status_details;
+  op++;
+  int was_cancelled = 2;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op++;
+  CHECK_EQ(grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops),
+                                 Tag(104), nullptr),
+           GRPC_CALL_OK);
+  cqv_->Expect(Tag(104), true);
+  cqv_->Verify();
+  EXPECT_EQ(was_cancelled, 0);
+  grpc_byte_buffer_destroy(first);
+  grpc_byte_buffer_destroy(second);
+  grpc_call_unref(s);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_call_details_destroy(&call_details);
+}
+
+INSTANTIATE_TEST_SUITE_P(BatchReadCompletions, BatchReadCompletionsTest,
+                         ::testing::Bool());
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -23,9 +23,13 @@
 #include <gtest/gtest.h>
 #include <string.h>
 
+#include <functional>
 #include <memory>
+#include <random>
+#include <vector>
 
 #include "absl/log/log.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/util/string.h"
 #include "test/core/test_util/test_config.h"
@@ -173,6 +177,29 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+TEST(BinEncoderTest, RandomInputsRoundTrip) {
+  std::mt19937 rng(0);
+  for (int i = 0; i < 1000; i++) {
+    std::vector<uint8_t> input(rng() % 100);
+    for (auto& c : input) c = static_cast<uint8_t>(rng());
+    grpc_slice slice = grpc_slice_from_copied_buffer(
+        reinterpret_cast<const char*>(input.data()), input.size());
+    grpc_slice compressed = grpc_chttp2_huffman_compress(slice);
+    std::vector<uint8_t> decoded;
+    EXPECT_TRUE(grpc_core::HuffDecoder<std::function<void(uint8_t)>>(
+                    [&decoded](uint8_t c) { decoded.push_back(c); },
+                    GRPC_SLICE_START_PTR(compressed),
+                    GRPC_SLICE_END_PTR(compressed))
+                    .Run());
+    EXPECT_EQ(decoded, input);
+    expect_combined_equiv(reinterpret_cast<const char*>(input.data()),
+                          input.size(), __LINE__);
+    grpc_slice_unref(compressed);
+    grpc_slice_unref(slice);
+  }
+  EXPECT_TRUE(all_ok);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
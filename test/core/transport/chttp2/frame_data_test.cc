@@ -0,0 +1,150 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class FakeCallTracer final : public CallTracerInterface {
+ public:
+  void RecordIncomingBytes(
+      const TransportByteSize& transport_byte_size) override {}
+  void RecordOutgoingBytes(
+      const TransportByteSize& transport_byte_size) override {
+    outgoing_framing_bytes += transport_byte_size.framing_bytes;
+  }
+  void RecordSendInitialMetadata(
+      grpc_metadata_batch* send_initial_metadata) override {}
+  void RecordSendTrailingMetadata(
+      grpc_metadata_batch* send_trailing_metadata) override {}
+  void RecordSendMessage(const Message& send_message) override {}
+  void RecordSendCompressedMessage(
+      const Message& send_compressed_message) override {}
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* recv_initial_metadata) override {}
+  void RecordReceivedMessage(const Message& recv_message) override {}
+  void RecordReceivedDecompressedMessage(
+      const Message& recv_decompressed_message) override {}
+  void RecordCancel(grpc_error_handle cancel_error) override {}
+  std::shared_ptr<TcpTracerInterface> StartNewTcpTrace() override {
+    return nullptr;
+  }
+  void RecordAnnotation(absl::string_view annotation) override {}
+  void RecordAnnotation(const Annotation& annotation) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+  uint64_t outgoing_framing_bytes = 0;
+};
+
+void ExpectDataFrameHeader(const grpc_slice& slice, uint32_t length,
+                           uint32_t stream_id, bool is_eof) {
+  ASSERT_GE(GRPC_SLICE_LENGTH(slice), 9u);
+  const uint8_t* p = GRPC_SLICE_START_PTR(slice);
+  EXPECT_EQ((static_cast<uint32_t>(p[0]) << 16) |
+                (static_cast<uint32_t>(p[1]) << 8) | p[2],
+            length);
+  EXPECT_EQ(p[3], GRPC_CHTTP2_FRAME_DATA);
+  EXPECT_EQ(p[4], is_eof ? GRPC_CHTTP2_DATA_FLAG_END_STREAM : 0);
+  EXPECT_EQ((static_cast<uint32_t>(p[5]) << 24) |
+                (static_cast<uint32_t>(p[6]) << 16) |
+                (static_cast<uint32_t>(p[7]) << 8) | p[8],
+            stream_id);
+}
+
+TEST(EncodeDataTest, PayloadIsMovedByReference) {
+  constexpr size_t kPayloadSize = 40000;
+  constexpr uint32_t kFrameSize = 16384;
+  grpc_slice payload = grpc_slice_malloc(kPayloadSize);
+  memset(GRPC_SLICE_START_PTR(payload), 'a', kPayloadSize);
+  const uint8_t* payload_start = GRPC_SLICE_START_PTR(payload);
+  grpc_slice_buffer inbuf;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&inbuf);
+  grpc_slice_buffer_init(&outbuf);
+  grpc_slice_buffer_add(&inbuf, payload);
+  FakeCallTracer call_tracer;
+  while (inbuf.length > 0) {
+    const uint32_t write_bytes =
+        std::min<uint32_t>(kFrameSize, static_cast<uint32_t>(inbuf.length));
+    grpc_chttp2_encode_data(7, &inbuf, write_bytes,
+                            write_bytes == inbuf.length, &call_tracer,
+                            &outbuf);
+  }
+  // Headers interleaved with slices of the original payload.
+  ASSERT_EQ(outbuf.count, 6u);
+  EXPECT_EQ(outbuf.length, kPayloadSize + 3 * 9);
+  for (size_t frame = 0; frame < 3; ++frame) {
+    const size_t offset = frame * kFrameSize;
+    const uint32_t length = static_cast<uint32_t>(
+        std::min<size_t>(kFrameSize, kPayloadSize - offset));
+    const grpc_slice& header = outbuf.slices[2 * frame];
+    const grpc_slice& data = outbuf.slices[2 * frame + 1];
+    EXPECT_EQ(GRPC_SLICE_LENGTH(header), 9u);
+    ExpectDataFrameHeader(header, length, 7, frame == 2);
+    EXPECT_EQ(GRPC_SLICE_START_PTR(data), payload_start + offset);
+    EXPECT_EQ(GRPC_SLICE_LENGTH(data), length);
+  }
+  EXPECT_EQ(call_tracer.outgoing_framing_bytes, 3 * 9u);
+  grpc_slice_buffer_destroy(&inbuf);
+  grpc_slice_buffer_destroy(&outbuf);
+}
+
+TEST(EncodeDataTest, MessagePrefixSharesTheFrameHeaderSlice) {
+  constexpr size_t kPayloadSize = 1000;
+  grpc_slice_buffer inbuf;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&inbuf);
+  grpc_slice_buffer_init(&outbuf);
+  // The gRPC message prefix, as added by the transport.
+  memset(grpc_slice_buffer_tiny_add(&inbuf, 5), 0, 5);
+  grpc_slice payload = grpc_slice_malloc(kPayloadSize);
+  memset(GRPC_SLICE_START_PTR(payload), 'a', kPayloadSize);
+  const uint8_t* payload_start = GRPC_SLICE_START_PTR(payload);
+  grpc_slice_buffer_add(&inbuf, payload);
+  FakeCallTracer call_tracer;
+  grpc_chttp2_encode_data(1, &inbuf, static_cast<uint32_t>(inbuf.length),
+                          false, &call_tracer, &outbuf);
+  ASSERT_EQ(outbuf.count, 2u);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(outbuf.slices[0]), 9u + 5u);
+  ExpectDataFrameHeader(outbuf.slices[0], kPayloadSize + 5, 1, false);
+  EXPECT_EQ(GRPC_SLICE_START_PTR(outbuf.slices[1]), payload_start);
+  grpc_slice_buffer_destroy(&inbuf);
+  grpc_slice_buffer_destroy(&outbuf);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
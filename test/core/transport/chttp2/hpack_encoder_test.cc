@@ -180,10 +180,8 @@ class FakeCallTracer final : public CallTracerInterface {
 }  // namespace grpc_core
 
 grpc_slice EncodeHeaderIntoBytes(
-    bool is_eof,
+    grpc_core::HPackCompressor* compressor, bool is_eof,
     const std::vector<std::pair<std::string, std::string>>& header_fields) {
-  std::unique_ptr<grpc_core::HPackCompressor> compressor =
-      std::make_unique<grpc_core::HPackCompressor>();
   grpc_metadata_batch b;
 
   for (const auto& field : header_fields) {
@@ -211,6 +209,14 @@ grpc_slice EncodeHeaderIntoBytes(
   return ret;
 }
 
+grpc_slice EncodeHeaderIntoBytes(
+    bool is_eof,
+    const std::vector<std::pair<std::string, std::string>>& header_fields) {
+  std::unique_ptr<grpc_core::HPackCompressor> compressor =
+      std::make_unique<grpc_core::HPackCompressor>();
+  return EncodeHeaderIntoBytes(compressor.get(), is_eof, header_fields);
+}
+
 // verify that the output generated by encoding the stream matches the
 // hexstring passed in
 static void verify(
@@ -325,6 +331,111 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+TEST(HpackEncoderTest, AdaptiveIndexingOfRepeatedMetadata) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  auto verify_with_compressor =
+      [&compressor](
+          const char* expected,
+          const std::vector<std::pair<std::string, std::string>>& fields) {
+    const grpc_core::Slice merged(
+        EncodeHeaderIntoBytes(&compressor, false, fields));
+    EXPECT_EQ(merged, grpc_core::Slice(grpc_core::ParseHexstring(expected)));
+  };
+  // First seen: literal without indexing.
+  verify_with_compressor("000005 0104 deadbeef 00 0161 0161", {{"a", "a"}});
+  // Repeated: literal with incremental indexing.
+  verify_with_compressor("000005 0104 deadbeef 40 0161 0161", {{"a", "a"}});
+  // Indexed.
+  verify_with_compressor("000001 0104 deadbeef be", {{"a", "a"}});
+  // A new value reuses the index of the key.
+  verify_with_compressor("000004 0104 deadbeef 0f2f 0162", {{"a", "b"}});
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingSkipsLargeEntries) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  // More than a quarter of the default 4096 byte table.
+  const std::string value(2000, 'v');
+  for (int i = 0; i < 3; i++) {
+    const grpc_slice encoded_header =
+        EncodeHeaderIntoBytes(&compressor, false, {{"a", value}});
+    EXPECT_THAT(encoded_header, HasLiteralHeaderFieldNewNameFlagNoIndexing());
+    grpc_slice_unref(encoded_header);
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0u);
+}
+
+TEST(HpackEncoderTest, AdaptiveIndexingNeverIndexesSensitiveMetadata) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  for (const char* key :
+       {"authorization", "proxy-authorization", "cookie", "x-session-cookie"}) {
+    for (int i = 0; i < 3; i++) {
+      const grpc_slice encoded_header =
+          EncodeHeaderIntoBytes(&compressor, false, {{key, "secret"}});
+      EXPECT_THAT(encoded_header, HasLiteralHeaderFieldNewNameFlagNoIndexing())
+          << key;
+      grpc_slice_unref(encoded_header);
+    }
+  }
+  EXPECT_EQ(compressor.test_only_table_size(), 0u);
+}
+
+TEST(HpackEncoderTest, EncodedBlockCacheReplaysAndInvalidates) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableEncodedBlockCache();
+  auto encode = [&compressor](
+                    const std::vector<std::pair<std::string, std::string>>&
+                        fields) {
+    return grpc_core::Slice(EncodeHeaderIntoBytes(&compressor, false, fields));
+  };
+  const std::vector<std::pair<std::string, std::string>> content_type = {
+      {"content-type", "application/grpc"}};
+  const grpc_core::Slice indexed_at_62(
+      grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  const grpc_core::Slice indexed_at_63(
+      grpc_core::ParseHexstring("000001 0104 deadbeef bf"));
+  // Inserted into the table: not cacheable.
+  encode(content_type);
+  // Indexed, and cached.
+  EXPECT_EQ(encode(content_type), indexed_at_62);
+  // Replayed from the cache.
+  EXPECT_EQ(encode(content_type), indexed_at_62);
+  // Inserting another entry moves content-type to a new index, which must not
+  // be served from the cache.
+  encode({{"user-agent", "x"}});
+  EXPECT_EQ(encode(content_type), indexed_at_63);
+}
+
+TEST(HpackEncoderTest, EncodedBlockCacheWithAdaptiveIndexing) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  compressor.EnableAdaptiveIndexing();
+  compressor.EnableEncodedBlockCache();
+  auto encode = [&compressor](
+                    const std::vector<std::pair<std::string, std::string>>&
+                        fields) {
+    return grpc_core::Slice(EncodeHeaderIntoBytes(&compressor, false, fields));
+  };
+  const std::vector<std::pair<std::string, std::string>> fields = {{"a", "a"}};
+  // The first block leaves the table unchanged, but must not be cached: the
+  // index has to see the pair again to index it.
+  EXPECT_EQ(encode(fields), grpc_core::Slice(grpc_core::ParseHexstring(
+                                "000005 0104 deadbeef 00 0161 0161")));
+  EXPECT_EQ(encode(fields), grpc_core::Slice(grpc_core::ParseHexstring(
+                                "000005 0104 deadbeef 40 0161 0161")));
+  const grpc_core::Slice indexed(
+      grpc_core::ParseHexstring("000001 0104 deadbeef be"));
+  EXPECT_EQ(encode(fields), indexed);
+  EXPECT_EQ(encode(fields), indexed);
+  EXPECT_EQ(compressor.test_only_table_size(), 34u);
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   grpc_core::MemoryAllocator memory_allocator =
@@ -26,6 +26,7 @@
 #include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/stats.h"
 #include "test/core/test_util/test_config.h"
@@ -188,6 +189,51 @@ TEST(HpackParserTableTest, ManyUnusedAdditions) {
   EXPECT_GT(num_buckets_changed, 0);
 }
 
+TEST(HpackParserTableTest, InternedSlicesAreShared) {
+  const std::string value(40, 'v');
+  Slice a = HPackInternedSlices::Intern(value);
+  Slice b = HPackInternedSlices::Intern(value);
+  EXPECT_EQ(a.as_string_view(), value);
+  EXPECT_EQ(a.data(), b.data());
+  // Neither short strings nor long ones are shared.
+  EXPECT_EQ(HPackInternedSlices::Intern("short").as_string_view(), "short");
+  const std::string long_value(HPackInternedSlices::kMaxLength + 1, 'v');
+  Slice c = HPackInternedSlices::Intern(long_value);
+  Slice d = HPackInternedSlices::Intern(long_value);
+  EXPECT_EQ(c.as_string_view(), long_value);
+  EXPECT_NE(c.data(), d.data());
+}
+
+TEST(HpackParserTableTest, ChargesMemoryOwner) {
+  ExecCtx exec_ctx;
+  auto memory_quota = MakeMemoryQuota("hpack_table");
+  MemoryOwner memory_owner = memory_quota->CreateMemoryOwner();
+  auto tbl = std::make_unique<HPackTable>();
+  tbl->SetMemoryOwner(&memory_owner);
+  size_t entries_size = 0;
+  for (int i = 0; i < 10; i++) {
+    std::string key = absl::StrCat("K.", i);
+    std::string value = absl::StrCat("VALUE.", i);
+    const size_t reserved_before = tbl->test_only_reserved_bytes();
+    ASSERT_TRUE(tbl->Add(HPackTable::Memento{
+        ParsedMetadata<grpc_metadata_batch>(
+            ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+            Slice::FromCopiedString(key), Slice::FromCopiedString(value),
+            key.length() + value.length() + 32),
+        nullptr}));
+    EXPECT_GE(tbl->test_only_reserved_bytes(),
+              reserved_before + key.length() + value.length() + 32);
+    entries_size += key.length() + value.length() + 32;
+  }
+  const size_t full_reservation = tbl->test_only_reserved_bytes();
+  tbl->AddLargerThanCurrentTableSize();
+  EXPECT_EQ(tbl->num_entries(), 0u);
+  EXPECT_EQ(tbl->test_only_reserved_bytes(), full_reservation - entries_size);
+  // The owner may go away first (as it does when transports are destroyed).
+  memory_owner.Reset();
+  tbl.reset();
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
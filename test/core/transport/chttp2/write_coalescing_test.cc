@@ -0,0 +1,431 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Drives a server chttp2 transport that coalesces writes with raw HTTP/2
+// frames, and checks when a held back write of call data reaches the client:
+// after the coalescing window on its own, and right away when a control frame
+// is queued, when the stream closes or when the transport closes.
+
+#include <grpc/byte_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/frame_ping.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/server/server.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
+#include "test/core/end2end/cq_verifier.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+// The coalescing window of the server. A held back write that reaches the
+// client in less than half of it was flushed early.
+constexpr int kCoalescingWindowUs = 1000000;
+constexpr absl::Duration kFlushedEarly =
+    absl::Microseconds(kCoalescingWindowUs / 2);
+
+constexpr char kMessage[] = "coalesced message";
+
+// HEADERS frame (END_HEADERS) opening stream 1 without ending it.
+constexpr char kRequestHeadersFrame[] =
+    "\x00\x00\xbe\x01\x04\x00\x00\x00\x01"
+    "\x10\x05:path\x08/foo/bar"
+    "\x10\x07:scheme\x04http"
+    "\x10\x07:method\x04POST"
+    "\x10\x0a:authority\x09localhost"
+    "\x10\x0c"
+    "content-type\x10"
+    "application/grpc"
+    "\x10\x14grpc-accept-encoding\x15identity,deflate,gzip"
+    "\x10\x02te\x08trailers"
+    "\x10\x0auser-agent\x17grpc-c/0.12.0.0 (linux)";
+
+class WriteCoalescingTest : public ::testing::Test {
+ protected:
+  WriteCoalescingTest() {
+    grpc_call_details_init(&call_details_);
+    grpc_metadata_array_init(&request_metadata_recv_);
+    SetupAndStart();
+  }
+
+  ~WriteCoalescingTest() override {
+    ShutdownAndDestroy();
+    grpc_metadata_array_destroy(&request_metadata_recv_);
+    grpc_call_details_destroy(&call_details_);
+  }
+
+  void SetupAndStart() {
+    ExecCtx exec_ctx;
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    cqv_ = std::make_unique<CqVerifier>(cq_);
+    grpc_arg server_args[] = {
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_HTTP2_BDP_PROBE), 0),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_KEEPALIVE_TIME_MS), INT_MAX),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_HTTP2_MAX_PING_STRIKES), 0),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>("grpc.experimental.http2_write_coalescing_us"),
+            kCoalescingWindowUs)};
+    grpc_channel_args server_channel_args = {GPR_ARRAY_SIZE(server_args),
+                                             server_args};
+    server_ = grpc_server_create(&server_channel_args, nullptr);
+    auto* core_server = Server::FromC(server_);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    fds_ = grpc_iomgr_create_endpoint_pair("fixture", nullptr);
+    transport_ = grpc_create_chttp2_transport(
+        core_server->channel_args(), OrphanablePtr<grpc_endpoint>(fds_.server),
+        false);
+    grpc_endpoint_add_to_pollset(fds_.server, grpc_cq_pollset(cq_));
+    CHECK(core_server->SetupTransport(transport_, nullptr,
+                                      core_server->channel_args(),
+                                      nullptr) == absl::OkStatus());
+    grpc_chttp2_transport_start_reading(transport_, nullptr, nullptr, nullptr,
+                                        nullptr);
+    // Start polling on the client
+    Notification client_poller_thread_started_notification;
+    client_poll_thread_ = std::make_unique<std::thread>(
+        [this, &client_poller_thread_started_notification]() {
+          grpc_completion_queue* client_cq =
+              grpc_completion_queue_create_for_next(nullptr);
+          {
+            ExecCtx exec_ctx;
+            grpc_endpoint_add_to_pollset(fds_.client,
+                                         grpc_cq_pollset(client_cq));
+            grpc_endpoint_add_to_pollset(fds_.server,
+                                         grpc_cq_pollset(client_cq));
+          }
+          client_poller_thread_started_notification.Notify();
+          while (!shutdown_) {
+            CHECK(grpc_completion_queue_next(
+                      client_cq, grpc_timeout_milliseconds_to_deadline(10),
+                      nullptr)
+                      .type == GRPC_QUEUE_TIMEOUT);
+          }
+          grpc_completion_queue_destroy(client_cq);
+        });
+    client_poller_thread_started_notification.WaitForNotification();
+    // Write connection prefix and settings frame
+    constexpr char kPrefix[] =
+        "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n\x00\x00\x00\x04\x00\x00\x00\x00\x00";
+    Write(absl::string_view(kPrefix, sizeof(kPrefix) - 1));
+    // Start reading on the client
+    grpc_slice_buffer_init(&read_buffer_);
+    GRPC_CLOSURE_INIT(&on_read_done_, OnReadDone, this, nullptr);
+    GRPC_CLOSURE_INIT(&on_read_done_scheduler_, OnReadDoneScheduler, this,
+                      nullptr);
+    grpc_endpoint_read(fds_.client, &read_buffer_, &on_read_done_, false,
+                       /*min_progress_size=*/1);
+  }
+
+  void ShutdownAndDestroy() {
+    shutdown_ = true;
+    ExecCtx exec_ctx;
+    {
+      MutexLock lock(&ep_destroy_mu_);
+      grpc_endpoint_destroy(fds_.client);
+      fds_.client = nullptr;
+    }
+    ExecCtx::Get()->Flush();
+    client_poll_thread_->join();
+    CHECK(read_end_notification_.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_server_shutdown_and_notify(server_, cq_, Tag(1000));
+    grpc_server_cancel_all_calls(server_);
+    cqv_->Expect(Tag(1000), true);
+    cqv_->Verify();
+    grpc_server_destroy(server_);
+    cqv_.reset();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  static void OnReadDone(void* arg, grpc_error_handle error) {
+    WriteCoalescingTest* self = static_cast<WriteCoalescingTest*>(arg);
+    if (error.ok()) {
+      {
+        MutexLock lock(&self->mu_);
+        for (size_t i = 0; i < self->read_buffer_.count; ++i) {
+          absl::StrAppend(&self->read_bytes_,
+                          StringViewFromSlice(self->read_buffer_.slices[i]));
+        }
+        self->read_cv_.SignalAll();
+      }
+      MutexLock lock(&self->ep_destroy_mu_);
+      if (self->fds_.client != nullptr) {
+        grpc_slice_buffer_reset_and_unref(&self->read_buffer_);
+        grpc_endpoint_read(self->fds_.client, &self->read_buffer_,
+                           &self->on_read_done_scheduler_, false,
+                           /*min_progress_size=*/1);
+        return;
+      }
+    }
+    grpc_slice_buffer_destroy(&self->read_buffer_);
+    self->read_end_notification_.Notify();
+  }
+
+  // Do async hop for OnReadDone() in case grpc_endpoint_read() invokes
+  // us synchronously while we're holding the lock.
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+    WriteCoalescingTest* self = static_cast<WriteCoalescingTest*>(arg);
+    ExecCtx::Run(DEBUG_LOCATION, &self->on_read_done_, std::move(error));
+  }
+
+  // Waits for `bytes` to show up in read_bytes_
+  void WaitForReadBytes(absl::string_view bytes) {
+    auto start_time = absl::Now();
+    MutexLock lock(&mu_);
+    while (true) {
+      auto where = read_bytes_.find(std::string(bytes));
+      if (where != std::string::npos) {
+        read_bytes_ = read_bytes_.substr(where + bytes.size());
+        break;
+      }
+      ASSERT_LT(absl::Now() - start_time, absl::Seconds(60));
+      read_cv_.WaitWithTimeout(&mu_, absl::Seconds(5));
+    }
+  }
+
+  void WaitForClose() {
+    ASSERT_TRUE(read_end_notification_.WaitForNotificationWithTimeout(
+        absl::Minutes(1)));
+  }
+
+  // This is a blocking call. It waits for the write callback to be invoked
+  // before returning.
+  void Write(absl::string_view bytes) {
+    ExecCtx exec_ctx;
+    grpc_slice_buffer buffer;
+    grpc_slice_buffer_init(&buffer);
+    grpc_slice_buffer_add(
+        &buffer, grpc_slice_from_copied_buffer(bytes.data(), bytes.size()));
+    Notification on_write_done_notification;
+    GRPC_CLOSURE_INIT(&on_write_done_, OnWriteDone,
+                      &on_write_done_notification, nullptr);
+    grpc_endpoint_write(fds_.client, &buffer, &on_write_done_, nullptr,
+                        /*max_frame_size=*/INT_MAX);
+    ExecCtx::Get()->Flush();
+    CHECK(on_write_done_notification.WaitForNotificationWithTimeout(
+        absl::Seconds(5)));
+    grpc_slice_buffer_destroy(&buffer);
+  }
+
+  static void OnWriteDone(void* arg, grpc_error_handle error) {
+    if (!error.ok()) {
+      Crash(absl::StrCat("Write failed: ", error.ToString()));
+    }
+    static_cast<Notification*>(arg)->Notify();
+  }
+
+  void SendPing(uint64_t opaque_data) {
+    grpc_slice ping_slice = grpc_chttp2_ping_create(0, opaque_data);
+    Write(StringViewFromSlice(ping_slice));
+    CSliceUnref(ping_slice);
+  }
+
+  void WaitForPingAck(uint64_t opaque_data) {
+    grpc_slice ping_slice = grpc_chttp2_ping_create(1, opaque_data);
+    WaitForReadBytes(StringViewFromSlice(ping_slice));
+    CSliceUnref(ping_slice);
+  }
+
+  // Has the client open stream 1, and returns the server call for it.
+  grpc_call* StartCall() {
+    grpc_call* call;
+    CHECK_EQ(grpc_server_request_call(server_, &call, &call_details_,
+                                      &request_metadata_recv_, cq_, cq_,
+                                      Tag(100)),
+             GRPC_CALL_OK);
+    Write(absl::string_view(kRequestHeadersFrame,
+                            sizeof(kRequestHeadersFrame) - 1));
+    cqv_->Expect(Tag(100), true);
+    cqv_->Verify();
+    return call;
+  }
+
+  // Makes the server write shortly before the next write of call data is
+  // initiated, so that the next write is held back for the coalescing window.
+  void WriteRecently() {
+    SendPing(1);
+    WaitForPingAck(1);
+    // Let the server see the end of the write of the ping ack.
+    absl::SleepFor(absl::Milliseconds(50));
+  }
+
+  // Starts sending initial metadata and kMessage on `call`.
+  void StartSendMessage(grpc_call* call, intptr_t tag) {
+    grpc_slice slice = grpc_slice_from_static_string(kMessage);
+    grpc_byte_buffer* message = grpc_raw_byte_buffer_create(&slice, 1);
+    grpc_op ops[2];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[0].data.send_initial_metadata.count = 0;
+    ops[1].op = GRPC_OP_SEND_MESSAGE;
+    ops[1].data.send_message.send_message = message;
+    CHECK_EQ(grpc_call_start_batch(call, ops, 2, Tag(tag), nullptr),
+             GRPC_CALL_OK);
+    grpc_byte_buffer_destroy(message);
+  }
+
+  // Starts sending the status on `call`, which closes the stream.
+  void StartSendStatus(grpc_call* call, intptr_t tag) {
+    grpc_op ops[2];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[0].data.send_status_from_server.trailing_metadata_count = 0;
+    ops[0].data.send_status_from_server.status = GRPC_STATUS_OK;
+    ops[1].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[1].data.recv_close_on_server.cancelled = &was_cancelled_;
+    CHECK_EQ(grpc_call_start_batch(call, ops, 2, Tag(tag), nullptr),
+             GRPC_CALL_OK);
+  }
+
+  // Held when destroying fds_.client so we know not to start another read.
+  Mutex ep_destroy_mu_;
+
+  grpc_endpoint_pair fds_;
+  Transport* transport_ = nullptr;
+  grpc_server* server_ = nullptr;
+  grpc_completion_queue* cq_ = nullptr;
+  std::unique_ptr<CqVerifier> cqv_;
+  std::unique_ptr<std::thread> client_poll_thread_;
+  std::atomic<bool> shutdown_{false};
+  grpc_closure on_read_done_;
+  grpc_closure on_read_done_scheduler_;
+  Mutex mu_;
+  CondVar read_cv_;
+  Notification read_end_notification_;
+  grpc_slice_buffer read_buffer_;
+  std::string read_bytes_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_write_done_;
+  grpc_call_details call_details_;
+  grpc_metadata_array request_metadata_recv_;
+  int was_cancelled_ = 2;
+};
+
+TEST_F(WriteCoalescingTest, HeldBackWriteIsSentAfterTheWindow) {
+  grpc_call* s = StartCall();
+  WriteRecently();
+  const absl::Time start = absl::Now();
+  StartSendMessage(s, 101);
+  WaitForReadBytes(kMessage);
+  EXPECT_GE(absl::Now() - start, kFlushedEarly);
+  cqv_->Expect(Tag(101), true);
+  cqv_->Verify();
+  StartSendStatus(s, 102);
+  cqv_->Expect(Tag(102), true);
+  cqv_->Verify();
+  grpc_call_unref(s);
+}
+
+TEST_F(WriteCoalescingTest, ControlFrameFlushesHeldBackWrite) {
+  grpc_call* s = StartCall();
+  WriteRecently();
+  const absl::Time start = absl::Now();
+  StartSendMessage(s, 101);
+  // The ping ack is a control frame, which is never held back.
+  SendPing(2);
+  WaitForReadBytes(kMessage);
+  EXPECT_LT(absl::Now() - start, kFlushedEarly);
+  cqv_->Expect(Tag(101), true);
+  cqv_->Verify();
+  StartSendStatus(s, 102);
+  cqv_->Expect(Tag(102), true);
+  cqv_->Verify();
+  grpc_call_unref(s);
+}
+
+TEST_F(WriteCoalescingTest, StreamCloseFlushesHeldBackWrite) {
+  grpc_call* s = StartCall();
+  WriteRecently();
+  const absl::Time start = absl::Now();
+  StartSendMessage(s, 101);
+  StartSendStatus(s, 102);
+  WaitForReadBytes(kMessage);
+  EXPECT_LT(absl::Now() - start, kFlushedEarly);
+  cqv_->Expect(Tag(101), true);
+  cqv_->Expect(Tag(102), true);
+  cqv_->Verify();
+  grpc_call_unref(s);
+}
+
+TEST_F(WriteCoalescingTest, TransportCloseFlushesHeldBackWrite) {
+  grpc_call* s = StartCall();
+  WriteRecently();
+  const absl::Time start = absl::Now();
+  StartSendMessage(s, 101);
+  {
+    ExecCtx exec_ctx;
+    grpc_transport_op* op = grpc_make_transport_op(nullptr);
+    op->disconnect_with_error = GRPC_ERROR_CREATE("test disconnect");
+    transport_->PerformOp(op);
+  }
+  // The transport closes its endpoint once the held back write is done.
+  WaitForClose();
+  EXPECT_LT(absl::Now() - start, kFlushedEarly);
+  cqv_->Expect(Tag(101), CqVerifier::AnyStatus());
+  cqv_->Verify();
+  grpc_call_unref(s);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
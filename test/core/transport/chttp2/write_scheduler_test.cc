@@ -0,0 +1,85 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_scheduler.h"
+
+#include <stdint.h>
+
+#include <limits>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(WriteSchedulerTest, DisabledByDefault) {
+  Chttp2WriteScheduler scheduler;
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_FALSE(scheduler.enabled());
+  EXPECT_EQ(scheduler.BeginTurn(&stream), std::numeric_limits<uint32_t>::max());
+  scheduler.EndTurn(&stream, 1000000, true);
+  EXPECT_EQ(stream.deficit, 0);
+}
+
+TEST(WriteSchedulerTest, TurnsAreWorthTheQuantumTimesTheWeight) {
+  Chttp2WriteScheduler scheduler;
+  scheduler.SetQuantum(1000);
+  Chttp2WriteScheduler::StreamState light;
+  Chttp2WriteScheduler::StreamState heavy;
+  heavy.weight = 4;
+  EXPECT_EQ(scheduler.BeginTurn(&light), 1000);
+  scheduler.EndTurn(&light, 1000, true);
+  EXPECT_EQ(scheduler.BeginTurn(&heavy), 4000);
+  scheduler.EndTurn(&heavy, 4000, true);
+}
+
+TEST(WriteSchedulerTest, BackloggedStreamsKeepTheirDeficit) {
+  Chttp2WriteScheduler scheduler;
+  scheduler.SetQuantum(1000);
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_EQ(scheduler.BeginTurn(&stream), 1000);
+  // A 700 byte frame would not fit in what is left of the turn.
+  scheduler.EndTurn(&stream, 600, true);
+  EXPECT_EQ(scheduler.BeginTurn(&stream), 1400);
+  scheduler.EndTurn(&stream, 1400, true);
+  EXPECT_EQ(scheduler.BeginTurn(&stream), 1000);
+}
+
+TEST(WriteSchedulerTest, IdleStreamsLoseTheirDeficit) {
+  Chttp2WriteScheduler scheduler;
+  scheduler.SetQuantum(1000);
+  Chttp2WriteScheduler::StreamState stream;
+  EXPECT_EQ(scheduler.BeginTurn(&stream), 1000);
+  scheduler.EndTurn(&stream, 100, false);
+  EXPECT_EQ(stream.deficit, 0);
+  EXPECT_EQ(scheduler.BeginTurn(&stream), 1000);
+}
+
+TEST(WriteSchedulerTest, ParseWeight) {
+  EXPECT_EQ(Chttp2WriteScheduler::ParseWeight(""), 1);
+  EXPECT_EQ(Chttp2WriteScheduler::ParseWeight("high"), 1);
+  EXPECT_EQ(Chttp2WriteScheduler::ParseWeight("0"), 1);
+  EXPECT_EQ(Chttp2WriteScheduler::ParseWeight("-5"), 1);
+  EXPECT_EQ(Chttp2WriteScheduler::ParseWeight("8"), 8);
+  EXPECT_EQ(Chttp2WriteScheduler::ParseWeight("100000000000"),
+            Chttp2WriteScheduler::kMaxWeight);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,6 +14,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 
+#include <chrono>
 #include <memory>
 
 #include "gtest/gtest.h"
@@ -116,6 +117,35 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(WriteSizePolicyTest, CoalescingDisabledByDefault) {
+  Chttp2WriteSizePolicy policy;
+  const auto now = std::chrono::steady_clock::now();
+  policy.NoteWriteEnded(now);
+  EXPECT_FALSE(policy.coalescing_enabled());
+  EXPECT_EQ(policy.CoalescingDelay(now), std::chrono::microseconds::zero());
+}
+
+TEST(WriteSizePolicyTest, CoalescingDelaysWritesFollowingARecentOne) {
+  Chttp2WriteSizePolicy policy;
+  policy.SetCoalescingWindow(std::chrono::microseconds(200));
+  const auto start = std::chrono::steady_clock::now();
+  // Nothing was written yet: the connection is idle.
+  EXPECT_EQ(policy.CoalescingDelay(start), std::chrono::microseconds::zero());
+  policy.NoteWriteEnded(start);
+  EXPECT_EQ(policy.CoalescingDelay(start + std::chrono::microseconds(50)),
+            std::chrono::microseconds(200));
+  // Idle for longer than the window.
+  EXPECT_EQ(policy.CoalescingDelay(start + std::chrono::microseconds(500)),
+            std::chrono::microseconds::zero());
+}
+
+TEST(WriteSizePolicyTest, CoalescingIsBoundedByTheWriteTarget) {
+  Chttp2WriteSizePolicy policy;
+  policy.SetCoalescingWindow(std::chrono::microseconds(200));
+  EXPECT_FALSE(policy.CoalescedEnough(1000));
+  EXPECT_TRUE(policy.CoalescedEnough(policy.WriteTargetSize()));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
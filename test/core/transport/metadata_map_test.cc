@@ -146,6 +146,50 @@ TEST(MetadataMapTest, NonTraitKeyWithMultipleValues) {
   EXPECT_EQ(map.GetStringValue(kKey, &buffer), "value1,value2");
 }
 
+TEST(MetadataMapTest, NameIndexFindsEveryTrait) {
+  using Index = metadata_detail::EncodableNameIndex<
+      HttpPathMetadata, HttpAuthorityMetadata, HttpMethodMetadata,
+      HttpStatusMetadata, HttpSchemeMetadata, ContentTypeMetadata, TeMetadata,
+      GrpcEncodingMetadata, GrpcInternalEncodingRequest,
+      GrpcAcceptEncodingMetadata, GrpcStatusMetadata, GrpcTimeoutMetadata,
+      GrpcPreviousRpcAttemptsMetadata, GrpcRetryPushbackMsMetadata,
+      UserAgentMetadata, GrpcMessageMetadata, HostMetadata,
+      EndpointLoadMetricsBinMetadata, GrpcServerStatsBinMetadata,
+      GrpcTraceBinMetadata, GrpcTagsBinMetadata>;
+  const std::vector<absl::string_view> keys = {
+      HttpPathMetadata::key(),
+      HttpAuthorityMetadata::key(),
+      HttpMethodMetadata::key(),
+      HttpStatusMetadata::key(),
+      HttpSchemeMetadata::key(),
+      ContentTypeMetadata::key(),
+      TeMetadata::key(),
+      GrpcEncodingMetadata::key(),
+      GrpcInternalEncodingRequest::key(),
+      GrpcAcceptEncodingMetadata::key(),
+      GrpcStatusMetadata::key(),
+      GrpcTimeoutMetadata::key(),
+      GrpcPreviousRpcAttemptsMetadata::key(),
+      GrpcRetryPushbackMsMetadata::key(),
+      UserAgentMetadata::key(),
+      GrpcMessageMetadata::key(),
+      HostMetadata::key(),
+      EndpointLoadMetricsBinMetadata::key(),
+      GrpcServerStatsBinMetadata::key(),
+      GrpcTraceBinMetadata::key(),
+      GrpcTagsBinMetadata::key(),
+  };
+  for (size_t i = 0; i < keys.size(); ++i) {
+    // A copy, so that keys are compared by value.
+    EXPECT_EQ(Index::Find(std::string(keys[i])), i) << keys[i];
+  }
+  for (absl::string_view key :
+       {"", "a", ":pat", ":path2", "grpc-status-details-bin", "user-agenT",
+        "x-user-agent", "content-length"}) {
+    EXPECT_EQ(Index::Find(key), Index::kNotFound) << key;
+  }
+}
+
 TEST(DebugStringBuilderTest, OneAddAfterRedaction) {
   metadata_detail::DebugStringBuilder b;
   b.AddAfterRedaction(ContentTypeMetadata::key(), "AddValue01");
@@ -19,6 +19,7 @@
 // Test gpr per-cpu support:
 // gpr_cpu_num_cores()
 // gpr_cpu_current_cpu()
+// grpc_core::GetCpuTopology()
 //
 
 #include <grpc/support/alloc.h>
@@ -30,8 +31,10 @@
 #include <string.h>
 
 #include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
+#include "src/core/util/cpu_topology.h"
 #include "src/core/util/thd.h"
 #include "test/core/test_util/test_config.h"
 
@@ -148,6 +151,25 @@ static void cpu_test(void) {
 
 TEST(CpuTest, MainTest) { cpu_test(); }
 
+TEST(CpuTest, Topology) {
+  std::vector<grpc_core::CpuInfo> topology = grpc_core::GetCpuTopology();
+#ifdef GPR_CPU_LINUX
+  ASSERT_FALSE(topology.empty());
+#endif
+  std::vector<unsigned> cpus;
+  for (const grpc_core::CpuInfo& info : topology) {
+    if (!cpus.empty()) {
+      EXPECT_LT(cpus.back(), info.cpu);
+    }
+    EXPECT_GE(info.numa_node, 0);
+    cpus.push_back(info.cpu);
+  }
+  // Pinning to every allowed CPU does not restrict the thread any further.
+  if (!cpus.empty()) {
+    EXPECT_TRUE(grpc_core::SetCurrentThreadAffinity(cpus));
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -20,6 +20,7 @@
 #include "absl/log/check.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/sharded_work_queue.h"
 #include "src/core/util/sync.h"
 #include "test/core/test_util/test_config.h"
 
@@ -28,23 +29,27 @@ namespace {
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::BasicWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::ShardedWorkQueue;
 
 grpc_core::Mutex globalMu;
-BasicWorkQueue globalWorkQueue;
 std::deque<EventEngine::Closure*> globalDeque;
 
+// The queue shared by all the threads of a multithreaded benchmark.
+template <typename Queue>
+Queue& GlobalWorkQueue() {
+  static Queue* queue = new Queue();
+  return *queue;
+}
+
 // --- Multithreaded Tests ---------------------------------------------------
 
 void MultithreadedTestArguments(benchmark::internal::Benchmark* b) {
-  b->Range(1, 512)
-      ->UseRealTime()
-      ->MeasureProcessCPUTime()
-      ->Threads(1)
-      ->Threads(4)
-      ->ThreadPerCpu();
+  b->Range(1, 512)->UseRealTime()->MeasureProcessCPUTime()->ThreadRange(1, 64);
 }
 
+template <typename Queue>
 void BM_MultithreadedWorkQueuePopOldest(benchmark::State& state) {
+  Queue& globalWorkQueue = GlobalWorkQueue<Queue>();
   AnyInvocableClosure closure([] {});
   int element_count = state.range(0);
   double pop_attempts = 0;
@@ -70,10 +75,14 @@ void BM_MultithreadedWorkQueuePopOldest(benchmark::State& state) {
     CHECK(globalWorkQueue.Empty());
   }
 }
-BENCHMARK(BM_MultithreadedWorkQueuePopOldest)
+BENCHMARK_TEMPLATE(BM_MultithreadedWorkQueuePopOldest, BasicWorkQueue)
+    ->Apply(MultithreadedTestArguments);
+BENCHMARK_TEMPLATE(BM_MultithreadedWorkQueuePopOldest, ShardedWorkQueue)
     ->Apply(MultithreadedTestArguments);
 
+template <typename Queue>
 void BM_MultithreadedWorkQueuePopMostRecent(benchmark::State& state) {
+  Queue& globalWorkQueue = GlobalWorkQueue<Queue>();
   AnyInvocableClosure closure([] {});
   int element_count = state.range(0);
   double pop_attempts = 0;
@@ -95,7 +104,9 @@ void BM_MultithreadedWorkQueuePopMostRecent(benchmark::State& state) {
     CHECK(globalWorkQueue.Empty());
   }
 }
-BENCHMARK(BM_MultithreadedWorkQueuePopMostRecent)
+BENCHMARK_TEMPLATE(BM_MultithreadedWorkQueuePopMostRecent, BasicWorkQueue)
+    ->Apply(MultithreadedTestArguments);
+BENCHMARK_TEMPLATE(BM_MultithreadedWorkQueuePopMostRecent, ShardedWorkQueue)
     ->Apply(MultithreadedTestArguments);
 
 void BM_MultithreadedStdDequeLIFO(benchmark::State& state) {
@@ -25,10 +25,13 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/string_view.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -626,6 +629,34 @@ class SameDeadline {
   }
 };
 
+// Literal, never indexed headers: every iteration classifies and validates
+// each key from scratch.
+class NonIndexedKnownKeys {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    std::vector<uint8_t> bytes;
+    auto add = [&bytes](absl::string_view key, absl::string_view value) {
+      bytes.push_back(0x10);
+      bytes.push_back(static_cast<uint8_t>(key.size()));
+      bytes.insert(bytes.end(), key.begin(), key.end());
+      bytes.push_back(static_cast<uint8_t>(value.size()));
+      bytes.insert(bytes.end(), value.begin(), value.end());
+    };
+    add(":path", "/grpc.testing.EchoTestService/Echo");
+    add(":authority", "foo.test.google.fr:1234");
+    add("content-type", "application/grpc");
+    add("te", "trailers");
+    add("user-agent", "grpc-c++/1.0 (linux; chttp2)");
+    add("grpc-accept-encoding", "identity,deflate,gzip");
+    add("grpc-timeout", "30S");
+    add("grpc-tags-bin", "AAECAwQFBgcICQoL");
+    add("x-custom-request-id", "0123456789abcdef0123456789abcdef");
+    add("x-custom-tenant", "some-tenant-with-a-long-name");
+    return {MakeSlice(bytes)};
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, EmptyBatch);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedSingleStaticElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, AddIndexedSingleStaticElem);
@@ -659,6 +690,7 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedKnownKeys);
 
 }  // namespace hpack_parser_fixtures
 
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <random>
+#include <vector>
 
 #include "absl/strings/escaping.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
@@ -84,6 +85,49 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
   BENCHMARK_CAPTURE(name, alpha_chars, AlphaChars)
 
 DECL_HUFFMAN_VARIANTS();
+// The decoder used by the HPACK parser, as a baseline for the variants.
+DECL_BENCHMARK(grpc_core::HuffDecoder, BM_HuffDecoder);
+
+const std::vector<uint8_t>& RawChars() {
+  static const auto* const data = new std::vector<uint8_t>([] {
+    std::vector<uint8_t> v;
+    std::uniform_int_distribution<> distribution(0, 255);
+    std::mt19937 rd(0);
+    v.reserve(64 * 1024);
+    for (int i = 0; i < 64 * 1024; i++) {
+      v.push_back(distribution(rd));
+    }
+    return v;
+  }());
+  return *data;
+}
+
+static void BM_HuffmanCompress(benchmark::State& state) {
+  const grpc_core::Slice input = grpc_core::Slice::FromCopiedBuffer(
+      absl::string_view(reinterpret_cast<const char*>(RawChars().data()),
+                        RawChars().size()));
+  for (auto _ : state) {
+    grpc_core::Slice output(grpc_chttp2_huffman_compress(input.c_slice()));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_HuffmanCompress);
+
+// Encoding of -bin metadata values when true binary is not enabled.
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  const grpc_core::Slice input = grpc_core::Slice::FromCopiedBuffer(
+      absl::string_view(reinterpret_cast<const char*>(RawChars().data()),
+                        state.range(0)));
+  for (auto _ : state) {
+    uint32_t wire_size;
+    grpc_core::Slice output(grpc_chttp2_base64_encode_and_huffman_compress(
+        input.c_slice(), &wire_size));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)->Range(16, 64 * 1024);
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
@@ -25,6 +25,7 @@
 #include "absl/strings/str_format.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/useful.h"
@@ -37,6 +38,7 @@ namespace {
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::ThreadPool;
+using ::grpc_event_engine::experimental::WorkStealingThreadPool;
 
 struct FanoutParameters {
   int depth;
@@ -105,6 +107,46 @@ BENCHMARK(BM_ThreadPool_RunClosure)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+// Benchmark threads, which are not pool threads, all schedule callbacks on the
+// same pool, so every callback goes through the global queue of the pool.
+// range(0) selects the global queue implementation: 0 for BasicWorkQueue, 1
+// for ShardedWorkQueue.
+void BM_ThreadPool_ConcurrentProducers(benchmark::State& state) {
+  static WorkStealingThreadPool* pool;
+  if (state.thread_index() == 0) {
+    WorkStealingThreadPool::Options options;
+    options.sharded_global_queue = state.range(0) != 0;
+    pool = new WorkStealingThreadPool(
+        grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u), options);
+  }
+  constexpr int kCallbacksPerIteration = 100;
+  for (auto _ : state) {
+    std::atomic_int runcount{0};
+    grpc_core::Notification signal;
+    for (int i = 0; i < kCallbacksPerIteration; i++) {
+      pool->Run([&signal, &runcount]() {
+        if (runcount.fetch_add(1, std::memory_order_relaxed) + 1 ==
+            kCallbacksPerIteration) {
+          signal.Notify();
+        }
+      });
+    }
+    signal.WaitForNotification();
+  }
+  state.SetItemsProcessed(kCallbacksPerIteration * state.iterations());
+  if (state.thread_index() == 0) {
+    pool->Quiesce();
+    delete pool;
+  }
+}
+BENCHMARK(BM_ThreadPool_ConcurrentProducers)
+    ->ArgName("sharded")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 64)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 void FanoutTestArguments(benchmark::internal::Benchmark* b) {
   // TODO(hork): enable when the engines are fast enough to run these:
   // ->Args({10000, 1})  // chain of callbacks scheduling callbacks
@@ -904,11 +904,17 @@ def _exclude_unwanted_cc_tests(tests: List[str]) -> List[str]:
         if not test.startswith("test/cpp/util:channelz_sampler_test")
     ]
 
-    # chaotic good not supported outside bazel
+    # chaotic good not supported outside bazel, apart from the tests that do
+    # not need its protos
+    chaotic_good_tests_outside_bazel = [
+        "test/core/transport/chaotic_good:receive_buffer_pool_test",
+        "test/core/transport/chaotic_good:shared_memory_endpoint_test",
+    ]
     tests = [
         test
         for test in tests
         if not test.startswith("test/core/transport/chaotic_good")
+        or test in chaotic_good_tests_outside_bazel
     ]
 
     # we don't need to generate fuzzers outside of bazel